@@ -39,6 +39,11 @@
 
 namespace Py
 {
+//
+//    Delay loaded builds check types with PyObject_IsInstance; define
+//    PYCXX_ISINSTANCE_CHECKS to keep that behaviour in other builds too
+//
+#if defined(PY_WIN32_DELAYLOAD_PYTHON_DLL) || defined(PYCXX_ISINSTANCE_CHECKS)
 static int _IsInstance( PyObject *op, PyTypeObject *type )
 {
     return PyObject_IsInstance( op, reinterpret_cast<PyObject *>( type ) );
@@ -73,6 +78,43 @@ PYCXX_EXPORT bool _CObject_Check( PyObject *op )     { return _IsInstance( op, _
 PYCXX_EXPORT bool _Bytes_Check( PyObject *op )       { return _IsInstance( op, _Bytes_Type() ) > 0; }
 #endif
 
+#else
+
+//
+//    Not delay loaded: the type objects are linked directly, so the checks
+//    map onto the flag-bit/type-pointer macros and never call __instancecheck__
+//
+PYCXX_EXPORT bool _CFunction_Check( PyObject *op )   { return PyCFunction_Check( op ); }
+PYCXX_EXPORT bool _Complex_Check( PyObject *op )     { return PyComplex_Check( op ); }
+PYCXX_EXPORT bool _Dict_Check( PyObject *op )        { return PyDict_Check( op ); }
+PYCXX_EXPORT bool _Float_Check( PyObject *op )       { return PyFloat_Check( op ); }
+#if PY_MAJOR_VERSION == 2 || !defined( Py_LIMITED_API )
+PYCXX_EXPORT bool _Function_Check( PyObject *op )    { return PyFunction_Check( op ); }
+#endif
+PYCXX_EXPORT bool _Boolean_Check( PyObject *op )     { return PyBool_Check( op ); }
+PYCXX_EXPORT bool _List_Check( PyObject *op )        { return PyList_Check( op ); }
+PYCXX_EXPORT bool _Long_Check( PyObject *op )        { return PyLong_Check( op ); }
+#if PY_MAJOR_VERSION == 2 || !defined( Py_LIMITED_API )
+PYCXX_EXPORT bool _Method_Check( PyObject *op )      { return PyMethod_Check( op ); }
+#endif
+PYCXX_EXPORT bool _Module_Check( PyObject *op )      { return PyModule_Check( op ); }
+PYCXX_EXPORT bool _Range_Check( PyObject *op )       { return PyRange_Check( op ); }
+PYCXX_EXPORT bool _Slice_Check( PyObject *op )       { return PySlice_Check( op ); }
+PYCXX_EXPORT bool _TraceBack_Check( PyObject *op )   { return PyTraceBack_Check( op ); }
+PYCXX_EXPORT bool _Tuple_Check( PyObject *op )       { return PyTuple_Check( op ); }
+PYCXX_EXPORT bool _Type_Check( PyObject *op )        { return PyType_Check( op ); }
+PYCXX_EXPORT bool _Unicode_Check( PyObject *op )     { return PyUnicode_Check( op ); }
+#if PY_MAJOR_VERSION == 2
+PYCXX_EXPORT bool _String_Check( PyObject *op )      { return PyString_Check( op ); }
+PYCXX_EXPORT bool _Int_Check( PyObject *op )         { return PyInt_Check( op ); }
+PYCXX_EXPORT bool _CObject_Check( PyObject *op )     { return PyCObject_Check( op ); }
+#endif
+#if PY_MAJOR_VERSION >= 3
+PYCXX_EXPORT bool _Bytes_Check( PyObject *op )       { return PyBytes_Check( op ); }
+#endif
+
+#endif
+
 #if defined(PY_WIN32_DELAYLOAD_PYTHON_DLL)
 
 # if defined(MS_WINDOWS)
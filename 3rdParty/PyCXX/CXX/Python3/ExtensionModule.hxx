@@ -96,7 +96,8 @@ namespace Py
         typedef Object (T::*method_noargs_function_t)();
         typedef Object (T::*method_varargs_function_t)( const Tuple &args );
         typedef Object (T::*method_keyword_function_t)( const Tuple &args, const Dict &kws );
-        typedef std::map<std::string, MethodDefExt<T> *> method_map_t;
+        typedef Object (T::*method_fastcall_function_t)( PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames );
+        typedef MethodMap<MethodDefExt<T> *> method_map_t;
 
         static void add_noargs_method( const char *name, method_noargs_function_t function, const char *doc="" )
         {
@@ -116,8 +117,26 @@ namespace Py
             mm[ std::string( name ) ] = new MethodDefExt<T>( name, function, method_keyword_call_handler, doc );
         }
 
+        // METH_FASTCALL|METH_KEYWORDS method. The call handler is generated for
+        // the member function and goes straight into the module's PyMethodDef
+        // table, so a call creates no capsule, args tuple or keywords dict.
+        // args/kwnames are borrowed, keyword values follow the nargs positionals.
+        // Must be called before initialize().
+        template<method_fastcall_function_t function>
+        void add_fastcall_method( const char *name, const char *doc="" )
+        {
+            m_method_table.add
+                (
+                name,
+                reinterpret_cast<PyCFunction>( reinterpret_cast<void (*)( void )>( &method_fastcall_call_handler<function> ) ),
+                doc,
+                METH_FASTCALL | METH_KEYWORDS
+                );
+        }
+
         void initialize( const char *module_doc="" )
         {
+            instance() = static_cast<T *>( this );
             ExtensionModuleBase::initialize( module_doc );
             Dict dict( moduleDictionary() );
 
@@ -153,6 +172,29 @@ namespace Py
         }
 
     protected:    // Tom Malcolmson reports that derived classes need access to these
+        // the module object of T, as for the capsule made in initialize()
+        // there is a single one per T
+        static T *&instance( void )
+        {
+            static T *the_instance = NULL;
+            return the_instance;
+        }
+
+        template<method_fastcall_function_t function>
+        static PyObject *method_fastcall_call_handler( PyObject *, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames )
+        {
+            try
+            {
+                Object result( (instance()->*function)( args, nargs, kwnames ) );
+
+                return new_reference_to( result.ptr() );
+            }
+            catch( BaseException & )
+            {
+                return 0;
+            }
+        }
+
         static method_map_t &methods( void )
         {
             static method_map_t *map_of_methods = NULL;
@@ -199,6 +241,158 @@ namespace Py
         ExtensionModule( const ExtensionModule<T> & );    //unimplemented
         void operator=( const ExtensionModule<T> & );    //unimplemented
     };
+
+    //
+    // Module defined by a static method table of free functions. The
+    // PyMethodDef entries are plain static data, so importing the module only
+    // runs PyModule_Create: no MethodDefExt, capsule, tuple or function object
+    // is made per method.
+    //
+    //    static PyMethodDef methods[] =
+    //    {
+    //        Py::method_def<&sum>( "sum", "Sum of the arguments" ),
+    //        Py::method_def<&count>( "count" ),
+    //        Py::method_def_end()
+    //    };
+    //    static Py::StaticModuleDef module_def( "name", "doc", methods );
+    //
+    //    PyMODINIT_FUNC PyInit_name() { return module_def.create(); }
+    //
+    typedef Object (*function_noargs_t)();
+    typedef Object (*function_varargs_t)( const Tuple &args );
+    typedef Object (*function_keyword_t)( const Tuple &args, const Dict &kws );
+    typedef Object (*function_fastcall_t)( PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames );
+
+    template<function_noargs_t function>
+    PyObject *function_noargs_call_handler( PyObject *, PyObject * )
+    {
+        try
+        {
+            Object result( function() );
+            return new_reference_to( result.ptr() );
+        }
+        catch( BaseException & )
+        {
+            return 0;
+        }
+    }
+
+    template<function_varargs_t function>
+    PyObject *function_varargs_call_handler( PyObject *, PyObject *_args )
+    {
+        try
+        {
+            Tuple args( _args, false, prechecked_t() );
+            Object result( function( args ) );
+            return new_reference_to( result.ptr() );
+        }
+        catch( BaseException & )
+        {
+            return 0;
+        }
+    }
+
+    template<function_keyword_t function>
+    PyObject *function_keyword_call_handler( PyObject *, PyObject *_args, PyObject *_keywords )
+    {
+        try
+        {
+            Tuple args( _args, false, prechecked_t() );
+
+            // _keywords may be NULL so be careful about the way the dict is created
+            Dict keywords;
+            if( _keywords != NULL )
+                keywords = Dict( _keywords, false, prechecked_t() );
+
+            Object result( function( args, keywords ) );
+            return new_reference_to( result.ptr() );
+        }
+        catch( BaseException & )
+        {
+            return 0;
+        }
+    }
+
+    template<function_fastcall_t function>
+    PyObject *function_fastcall_call_handler( PyObject *, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames )
+    {
+        try
+        {
+            Object result( function( args, nargs, kwnames ) );
+            return new_reference_to( result.ptr() );
+        }
+        catch( BaseException & )
+        {
+            return 0;
+        }
+    }
+
+    // PyMethodDef entries for a static method table, one per function signature
+    template<function_noargs_t function>
+    inline PyMethodDef method_def( const char *name, const char *doc="" )
+    {
+        PyMethodDef def = { name, &function_noargs_call_handler<function>, METH_NOARGS, doc };
+        return def;
+    }
+
+    template<function_varargs_t function>
+    inline PyMethodDef method_def( const char *name, const char *doc="" )
+    {
+        PyMethodDef def = { name, &function_varargs_call_handler<function>, METH_VARARGS, doc };
+        return def;
+    }
+
+    template<function_keyword_t function>
+    inline PyMethodDef method_def( const char *name, const char *doc="" )
+    {
+        PyMethodDef def =
+        {
+            name,
+            reinterpret_cast<PyCFunction>( reinterpret_cast<void (*)( void )>( &function_keyword_call_handler<function> ) ),
+            METH_VARARGS | METH_KEYWORDS,
+            doc
+        };
+        return def;
+    }
+
+    template<function_fastcall_t function>
+    inline PyMethodDef method_def( const char *name, const char *doc="" )
+    {
+        PyMethodDef def =
+        {
+            name,
+            reinterpret_cast<PyCFunction>( reinterpret_cast<void (*)( void )>( &function_fastcall_call_handler<function> ) ),
+            METH_FASTCALL | METH_KEYWORDS,
+            doc
+        };
+        return def;
+    }
+
+    // sentinel ending a static method table
+    inline PyMethodDef method_def_end()
+    {
+        PyMethodDef def = { NULL, NULL, 0, NULL };
+        return def;
+    }
+
+    class PYCXX_EXPORT StaticModuleDef
+    {
+    public:
+        // name, doc and methods must outlive the module (static storage)
+        StaticModuleDef( const char *name, const char *doc, PyMethodDef *methods );
+
+        // create the module, the result of PyInit_<module> (new reference)
+        PyObject *create();
+
+    private:
+        PyModuleDef m_module_def;
+
+        //
+        // prevent the compiler generating these unwanted functions
+        //
+        StaticModuleDef( const StaticModuleDef & );     //unimplemented
+        void operator=( const StaticModuleDef & );      //unimplemented
+    };
 } // Namespace Py
 
 
@@ -112,7 +112,7 @@ namespace Py
         typedef Object (T::*method_noargs_function_t)();
         typedef Object (T::*method_varargs_function_t)( const Tuple &args );
         typedef Object (T::*method_keyword_function_t)( const Tuple &args, const Dict &kws );
-        typedef std::map<std::string, MethodDefExt<T> *> method_map_t;
+        typedef MethodMap<MethodDefExt<T> *> method_map_t;
 
         // support the default attributes, __name__, __doc__ and methods
         virtual Object getattr_default( const char *_name )
@@ -153,14 +153,14 @@ namespace Py
         // turn a name into function object
         virtual Object getattr_methods( const char *_name )
         {
-            std::string name( _name );
-
             method_map_t &mm = methods();
 
             // see if name exists and get entry with method
-            EXPLICIT_TYPENAME method_map_t::const_iterator i = mm.find( name );
+            EXPLICIT_TYPENAME method_map_t::const_iterator i = mm.find( _name );
             if( i == mm.end() )
             {
+                std::string name( _name );
+
                 if( name == "__dict__" ) // __methods__ is not supported in Py3 any more, use __dict__ instead
                 {
                     Dict methods;
@@ -189,8 +189,32 @@ namespace Py
                 throw AttributeError( name );
             }
 
-            MethodDefExt<T> *method_def = i->second;
+            return bind_method( i->second );
+        }
+
+        // getattr_methods for a str name, as passed to getattro: interned names
+        // are resolved by pointer without converting them to a C string
+        Object getattro_methods( const Object &name )
+        {
+            method_map_t &mm = methods();
 
+            EXPLICIT_TYPENAME method_map_t::const_iterator i = mm.find_object( name.ptr() );
+            if( i == mm.end() )
+            {
+                return getattr_methods( String( name ).as_std_string( "utf-8" ).c_str() );
+            }
+
+            return bind_method( i->second );
+        }
+
+        // function object calling method_def on this object
+        Object bind_method( MethodDefExt<T> *method_def )
+        {
+#if !defined( Py_LIMITED_API )
+            // bind the per class function of the method to this object:
+            // a single allocation per attribute access
+            return Object( PyMethod_New( bound_method_function( method_def ), this ), true );
+#else
             Tuple self( 2 );
 
             self[0] = Object( this );
@@ -199,6 +223,7 @@ namespace Py
             PyObject *func = PyCFunction_NewEx( &method_def->ext_meth_def, self.ptr(), NULL );
 
             return Object(func, true);
+#endif
         }
 
         // check that all methods added are unique
@@ -345,6 +370,89 @@ namespace Py
             }
         }
 
+#if !defined( Py_LIMITED_API )
+        // The function object shared by all instances for method_def, created on
+        // first use and kept in method_def->py_method. It is called as a bound
+        // method, the instance arrives as the first argument (borrowed result).
+        static PyObject *bound_method_function( MethodDefExt<T> *method_def )
+        {
+            if( method_def->py_method.ptr() == Py::_None() )
+            {
+                PyMethodDef *def = new PyMethodDef;
+                def->ml_name = method_def->ext_meth_def.ml_name;
+                def->ml_meth = reinterpret_cast<PyCFunction>( reinterpret_cast<void (*)( void )>( method_bound_call_handler ) );
+                def->ml_flags = METH_FASTCALL | METH_KEYWORDS;
+                def->ml_doc = method_def->ext_meth_def.ml_doc;
+
+                Object method_in_cobject( PyCapsule_New( method_def, NULL, NULL ), true );
+                method_def->py_method = Object( PyCFunction_NewEx( def, method_in_cobject.ptr(), NULL ), true );
+            }
+
+            return method_def->py_method.ptr();
+        }
+
+        static PyObject *method_bound_call_handler( PyObject *_method_in_cobject, PyObject *const *_args, Py_ssize_t _nargs, PyObject *_kwnames )
+        {
+            try
+            {
+                MethodDefExt<T> *meth_def = reinterpret_cast<MethodDefExt<T> *>(
+                                                PyCapsule_GetPointer( _method_in_cobject, NULL ) );
+
+                if( _nargs < 1 || !check( _args[0] ) )
+                {
+                    throw TypeError( std::string( meth_def->ext_meth_def.ml_name ) + "() must be called on its object" );
+                }
+
+                T *self = static_cast<T *>( _args[0] );
+                Py_ssize_t nkw = _kwnames != NULL ? PyTuple_GET_SIZE( _kwnames ) : 0;
+
+                if( meth_def->ext_noargs_function != NULL )
+                {
+                    if( _nargs != 1 || nkw != 0 )
+                    {
+                        throw TypeError( std::string( meth_def->ext_meth_def.ml_name ) + "() takes no arguments" );
+                    }
+
+                    Object result( (self->*meth_def->ext_noargs_function)() );
+                    return new_reference_to( result.ptr() );
+                }
+
+                Tuple args( PyTuple_New( _nargs - 1 ), true );
+                for( Py_ssize_t i = 1; i < _nargs; i++ )
+                {
+                    PyTuple_SET_ITEM( args.ptr(), i - 1, new_reference_to( _args[i] ) );
+                }
+
+                if( meth_def->ext_varargs_function != NULL )
+                {
+                    if( nkw != 0 )
+                    {
+                        throw TypeError( std::string( meth_def->ext_meth_def.ml_name ) + "() takes no keyword arguments" );
+                    }
+
+                    Object result( (self->*meth_def->ext_varargs_function)( args ) );
+                    return new_reference_to( result.ptr() );
+                }
+
+                Dict keywords;
+                for( Py_ssize_t i = 0; i < nkw; i++ )
+                {
+                    if( PyDict_SetItem( keywords.ptr(), PyTuple_GET_ITEM( _kwnames, i ), _args[_nargs + i] ) == -1 )
+                    {
+                        ifPyErrorThrowCxxException();
+                    }
+                }
+
+                Object result( (self->*meth_def->ext_keyword_function)( args, keywords ) );
+                return new_reference_to( result.ptr() );
+            }
+            catch( BaseException & )
+            {
+                return 0;
+            }
+        }
+#endif
+
         static void extension_object_deallocator( PyObject* t )
         {
             delete (T *)( t );
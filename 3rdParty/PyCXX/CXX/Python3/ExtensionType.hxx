@@ -189,6 +189,94 @@ namespace Py
         int m_methods_size;
     };
 
+    //
+    // Bounded list of freed instance memory kept for reuse by one PythonClass<T>.
+    // The next pointer is stored in the first bytes of each dead object.
+    //
+    class ExtensionObjectFreelist
+    {
+    public:
+        ExtensionObjectFreelist()
+        : m_head( NULL )
+        , m_size( 0 )
+#if defined( Py_GIL_DISABLED )
+        , m_mutex()
+#endif
+        {
+        }
+
+        ~ExtensionObjectFreelist()
+        {
+            // PyObject_Free needs an attached thread state, after Py_Finalize
+            // or on a thread without one the memory goes with the process
+            if( Py_IsInitialized() && PyGILState_Check() )
+                clear();
+        }
+
+        Py_ssize_t size() const
+        {
+            lock();
+            Py_ssize_t size = m_size;
+            unlock();
+            return size;
+        }
+
+        PyObject *pop()
+        {
+            lock();
+            PyObject *object = m_head;
+            if( object != NULL )
+            {
+                m_head = *reinterpret_cast<PyObject **>( object );
+                --m_size;
+            }
+            unlock();
+            return object;
+        }
+
+        bool push( PyObject *object, Py_ssize_t limit )
+        {
+            lock();
+            bool pushed = m_size < limit;
+            if( pushed )
+            {
+                *reinterpret_cast<PyObject **>( object ) = m_head;
+                m_head = object;
+                ++m_size;
+            }
+            unlock();
+            return pushed;
+        }
+
+        void clear()
+        {
+            while( PyObject *object = pop() )
+                PyObject_Free( object );
+        }
+
+    private:
+        // without the GIL the list is shared by all threads under a mutex
+        void lock() const
+        {
+#if defined( Py_GIL_DISABLED )
+            PyMutex_Lock( &m_mutex );
+#endif
+        }
+
+        void unlock() const
+        {
+#if defined( Py_GIL_DISABLED )
+            PyMutex_Unlock( &m_mutex );
+#endif
+        }
+
+        PyObject *m_head;
+        Py_ssize_t m_size;
+#if defined( Py_GIL_DISABLED )
+        mutable PyMutex m_mutex;
+#endif
+    };
+
     template<TEMPLATE_TYPENAME T> class PythonClass
     : public PythonExtensionBase
     {
@@ -199,6 +287,13 @@ namespace Py
         {
         }
 
+        // used by constructors called from a vectorcall init, see set_vectorcall_init
+        explicit PythonClass( PythonClassInstance *self )
+        : PythonExtensionBase()
+        , m_class_instance( self )
+        {
+        }
+
         virtual ~PythonClass()
         {}
 
@@ -246,13 +341,26 @@ namespace Py
 #ifdef PYCXX_DEBUG
             std::cout << "extension_object_new()" << std::endl;
 #endif
+            PyObject *object = NULL;
+            if( subtype == type_object() && freelist_limit() > 0 )
+                object = freelist().pop();
+
+            if( object != NULL )
+            {
+                // same state tp_alloc leaves behind
+                memset( object, 0, sizeof( PythonClassInstance ) );
+                PyObject_Init( object, subtype );
+            }
+            else
+            {
 #if defined( Py_LIMITED_API )
-            PyObject *object = reinterpret_cast<allocfunc>( PyType_GetSlot( subtype, Py_tp_alloc ) )( subtype, 0 );
+                object = reinterpret_cast<allocfunc>( PyType_GetSlot( subtype, Py_tp_alloc ) )( subtype, 0 );
 #else
-            PyObject *object = subtype->tp_alloc( subtype, 0 );
+                object = subtype->tp_alloc( subtype, 0 );
 #endif
-            if( object == NULL )
-                return NULL;
+                if( object == NULL )
+                    return NULL;
+            }
 
             PythonClassInstance *o = reinterpret_cast<PythonClassInstance *>( object );
             o->m_pycxx_object = NULL;
@@ -301,6 +409,45 @@ namespace Py
             return 0;
         }
 
+#if !defined( Py_LIMITED_API )
+        // constructs m_pycxx_object from a vectorcall, returns false with a python error set
+        typedef bool (*vectorcall_init_t)( PythonClassInstance *self, PyObject *const *args, size_t nargsf, PyObject *kwnames );
+
+        //
+        // Calls to the type skip tp_new + tp_init and go straight to init.
+        // Subclasses defined in python do not inherit it and still use tp_init,
+        // so T( self, args, kwds ) remains required.
+        //
+        template<vectorcall_init_t init>
+        static void set_vectorcall_init()
+        {
+            behaviors().set_tp_vectorcall( extension_object_vectorcall<init> );
+        }
+
+        template<vectorcall_init_t init>
+        static PyObject *extension_object_vectorcall( PyObject *type, PyObject *const *args, size_t nargsf, PyObject *kwnames )
+        {
+            PyObject *object = extension_object_new( reinterpret_cast<PyTypeObject *>( type ), NULL, NULL );
+            if( object == NULL )
+                return NULL;
+
+            try
+            {
+                if( !init( reinterpret_cast<PythonClassInstance *>( object ), args, nargsf, kwnames ) )
+                {
+                    Py_DECREF( object );
+                    return NULL;
+                }
+            }
+            catch( BaseException & )
+            {
+                Py_DECREF( object );
+                return NULL;
+            }
+            return object;
+        }
+#endif
+
         static void extension_object_deallocator( PyObject *_self )
         {
             PythonClassInstance *self = reinterpret_cast< PythonClassInstance * >( _self );
@@ -309,6 +456,12 @@ namespace Py
             std::cout << "    self->m_pycxx_object=0x" << std::hex << reinterpret_cast< unsigned long >( self->m_pycxx_object ) << std::dec << std::endl;
 #endif
             delete self->m_pycxx_object;
+
+            // only exact T instances are pooled, python subclasses have their own size
+            if( _self->ob_type == type_object() && !PyType_IS_GC( _self->ob_type )
+            && freelist().push( _self, freelist_limit() ) )
+                return;
+
 #ifdef Py_LIMITED_API
             freefunc fn = reinterpret_cast<freefunc>( PyType_GetSlot( _self->ob_type, Py_tp_free ) );
             fn( _self );
@@ -317,6 +470,66 @@ namespace Py
 #endif
         }
 
+        static Py_ssize_t &freelist_limit()
+        {
+            static Py_ssize_t limit = 0;
+            return limit;
+        }
+
+        static ExtensionObjectFreelist &freelist()
+        {
+            static ExtensionObjectFreelist list;
+            return list;
+        }
+
+    public:
+        //
+        // Opt-in reuse of freed T instances, avoiding tp_alloc and tp_free for
+        // types created and destroyed at high rates. Keeps at most size objects
+        // (shared by all threads, under a mutex with free-threading), 0 turns it
+        // off and empties the list.
+        //
+        static void set_freelist_size( Py_ssize_t size )
+        {
+            freelist_limit() = size;
+            while( freelist().size() > size )
+                PyObject_Free( freelist().pop() );
+        }
+
+        static Py_ssize_t freelist_size()
+        {
+            return freelist().size();
+        }
+
+    public:
+        //
+        // New instance of the type owning the T returned by make(), without
+        // calling the type: for results returned by value (e.g. operators).
+        // The T is built in place from the returned value (no copy), usually
+        // with a NULL self, and bound to the new instance.
+        //
+        template<typename F>
+        static PyObject *new_instance( F make )
+        {
+            return adopt_instance( new T( make() ) );
+        }
+
+    private:
+        static PyObject *adopt_instance( T *cxx_object )
+        {
+            PyObject *object = extension_object_new( type_object(), NULL, NULL );
+            if( object == NULL )
+            {
+                delete cxx_object;
+                return NULL;
+            }
+
+            PythonClassInstance *self = reinterpret_cast<PythonClassInstance *>( object );
+            static_cast<PythonClass *>( cxx_object )->m_class_instance = self;
+            self->m_pycxx_object = cxx_object;
+            return object;
+        }
+
     public:
         static PyTypeObject *type_object()
         {
@@ -98,6 +98,250 @@ namespace Py
 
     }; // end class MethodTable
 
+    //
+    // Method lookup table: name -> V, iterated in name order like the std::map
+    // it replaces. Lookups go through flat open addressing indexes built on
+    // first use: by interned str object (pointer compare, the str hash is
+    // cached in the object) or by C string (FNV-1a, strcmp on a hash match).
+    // The interned names are kept for the life of the table; copies share
+    // only the entries and build their own indexes.
+    //
+    template<TEMPLATE_TYPENAME V>
+    class MethodMap
+    {
+    public:
+        typedef std::pair<std::string, V> value_type;
+        typedef EXPLICIT_TYPENAME std::vector<value_type>::iterator iterator;
+        typedef EXPLICIT_TYPENAME std::vector<value_type>::const_iterator const_iterator;
+
+        MethodMap()
+        : entries()
+        , str_hashes()
+        , str_slots()
+        , object_names()
+        , object_hashes()
+        , object_slots()
+        {}
+
+        MethodMap( const MethodMap &other )
+        : entries( other.entries )
+        , str_hashes()
+        , str_slots()
+        , object_names()
+        , object_hashes()
+        , object_slots()
+        {}
+
+        MethodMap( MethodMap &&other ) noexcept
+        : entries()
+        , str_hashes()
+        , str_slots()
+        , object_names()
+        , object_hashes()
+        , object_slots()
+        {
+            swap( other );
+        }
+
+        MethodMap &operator=( MethodMap other ) noexcept
+        {
+            swap( other );
+            return *this;
+        }
+
+        ~MethodMap()
+        {
+            release_object_names();
+        }
+
+        void swap( MethodMap &other ) noexcept
+        {
+            entries.swap( other.entries );
+            str_hashes.swap( other.str_hashes );
+            str_slots.swap( other.str_slots );
+            object_names.swap( other.object_names );
+            object_hashes.swap( other.object_hashes );
+            object_slots.swap( other.object_slots );
+        }
+
+        // finds name, inserting a default V if missing
+        V &operator[]( const std::string &name )
+        {
+            iterator i = std::lower_bound( entries.begin(), entries.end(), name, name_less );
+            if( i == entries.end() || i->first != name )
+            {
+                i = entries.insert( i, value_type( name, V() ) );
+                invalidate();
+            }
+            return i->second;
+        }
+
+        const_iterator find( const std::string &name ) const
+        {
+            return find( name.c_str() );
+        }
+
+        const_iterator find( const char *name ) const
+        {
+            if( name == NULL )
+                return entries.end();
+
+            if( str_slots.empty() )
+                build_str_index();
+
+            size_t hash = hash_name( name );
+            size_t mask = str_slots.size() - 1;
+            for( size_t slot = hash & mask; str_slots[ slot ] != 0; slot = ( slot + 1 ) & mask )
+            {
+                size_t index = str_slots[ slot ] - 1;
+                if( str_hashes[ index ] == hash && entries[ index ].first == name )
+                    return entries.begin() + index;
+            }
+            return entries.end();
+        }
+
+        // name is a str, usually interned (attribute names from the interpreter are).
+        // Not an overload of find, so find( NULL ) is not ambiguous.
+        const_iterator find_object( PyObject *name ) const
+        {
+            if( name == NULL || !Py::_Unicode_Check( name ) )
+                return entries.end();
+
+            Py_hash_t hash = PyObject_Hash( name );
+            if( hash == -1 )
+            {
+                PyErr_Clear();
+                return entries.end();
+            }
+
+            if( object_slots.empty() )
+                build_object_index();
+
+            size_t mask = object_slots.size() - 1;
+            for( size_t slot = static_cast<size_t>( hash ) & mask; object_slots[ slot ] != 0; slot = ( slot + 1 ) & mask )
+            {
+                size_t index = object_slots[ slot ] - 1;
+                if( object_names[ index ] == name )
+                    return entries.begin() + index;
+                if( object_hashes[ index ] == hash && PyUnicode_Compare( object_names[ index ], name ) == 0 )
+                    return entries.begin() + index;
+            }
+            return entries.end();
+        }
+
+        iterator begin()                { return entries.begin(); }
+        iterator end()                  { return entries.end(); }
+        const_iterator begin() const    { return entries.begin(); }
+        const_iterator end() const      { return entries.end(); }
+        size_t size() const             { return entries.size(); }
+        bool empty() const              { return entries.empty(); }
+
+    private:
+        static bool name_less( const value_type &entry, const std::string &name )
+        {
+            return entry.first < name;
+        }
+
+        static size_t hash_name( const char *name )
+        {
+            // FNV-1a
+            size_t hash = static_cast<size_t>( 14695981039346656037ULL );
+            for( ; *name != '\0'; ++name )
+            {
+                hash ^= static_cast<unsigned char>( *name );
+                hash *= static_cast<size_t>( 1099511628211ULL );
+            }
+            return hash;
+        }
+
+        // power of two with a load factor of at most 1/2
+        size_t index_size() const
+        {
+            size_t n = 8;
+            while( n < entries.size() * 2 )
+                n *= 2;
+            return n;
+        }
+
+        void invalidate()
+        {
+            str_slots.clear();
+            object_slots.clear();
+            release_object_names();
+        }
+
+        void release_object_names()
+        {
+            // after Py_Finalize the names are gone with the interpreter
+            if( Py_IsInitialized() )
+            {
+                for( size_t i = 0; i < object_names.size(); ++i )
+                    Py::_XDECREF( object_names[ i ] );
+            }
+            object_names.clear();
+        }
+
+        void build_str_index() const
+        {
+            str_slots.assign( index_size(), 0 );
+            str_hashes.resize( entries.size() );
+
+            size_t mask = str_slots.size() - 1;
+            for( size_t i = 0; i < entries.size(); ++i )
+            {
+                str_hashes[ i ] = hash_name( entries[ i ].first.c_str() );
+
+                size_t slot = str_hashes[ i ] & mask;
+                while( str_slots[ slot ] != 0 )
+                    slot = ( slot + 1 ) & mask;
+                str_slots[ slot ] = static_cast<unsigned int>( i + 1 );
+            }
+        }
+
+        // built aside and swapped in, so a failure leaves no half built index
+        void build_object_index() const
+        {
+            std::vector<PyObject *> names;
+            names.reserve( entries.size() );
+            std::vector<Py_hash_t> hashes( entries.size() );
+            std::vector<unsigned int> slots( index_size(), 0 );
+
+            size_t mask = slots.size() - 1;
+            for( size_t i = 0; i < entries.size(); ++i )
+            {
+                PyObject *name = PyUnicode_InternFromString( entries[ i ].first.c_str() );
+                if( name == NULL )
+                {
+                    for( size_t j = 0; j < names.size(); ++j )
+                        Py::_XDECREF( names[ j ] );
+                    ifPyErrorThrowCxxException();
+                }
+                names.push_back( name );
+                hashes[ i ] = PyObject_Hash( name );
+
+                size_t slot = static_cast<size_t>( hashes[ i ] ) & mask;
+                while( slots[ slot ] != 0 )
+                    slot = ( slot + 1 ) & mask;
+                slots[ slot ] = static_cast<unsigned int>( i + 1 );
+            }
+
+            object_names.swap( names );
+            object_hashes.swap( hashes );
+            object_slots.swap( slots );
+
+            // names now holds the previous (normally empty) set of references
+            for( size_t j = 0; j < names.size(); ++j )
+                Py::_XDECREF( names[ j ] );
+        }
+
+        std::vector<value_type> entries;                // sorted by name
+        mutable std::vector<size_t> str_hashes;         // parallel to entries
+        mutable std::vector<unsigned int> str_slots;    // entry index + 1, 0 when empty
+        mutable std::vector<PyObject *> object_names;   // interned, parallel to entries
+        mutable std::vector<Py_hash_t> object_hashes;
+        mutable std::vector<unsigned int> object_slots;
+    };
+
     // Note: Python calls noargs as varargs buts args==NULL
     extern "C" typedef PyObject *(*method_noargs_call_handler_t)( PyObject *_self, PyObject * );
     extern "C" typedef PyObject *(*method_varargs_call_handler_t)( PyObject *_self, PyObject *_args );
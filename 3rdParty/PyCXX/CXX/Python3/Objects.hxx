@@ -52,6 +52,8 @@
 #include <typeinfo>
 #include <algorithm>
 #include <cstring>
+#include <new>
+#include <type_traits>
 
 namespace Py
 {
@@ -139,6 +141,10 @@ namespace Py
     // which you can use in accepts when writing a wrapper class.
     // See Demo/range.h and Demo/range.cxx for an example.
 
+    // Tag for constructors whose pointer the caller has already type checked
+    // (for example by an argument parser); validate() is not called again.
+    struct prechecked_t {};
+
     class PYCXX_EXPORT Object
     {
     private:
@@ -171,6 +177,8 @@ namespace Py
 
     public:
         // Constructor acquires new ownership of pointer unless explicitly told not to.
+        // Object accepts any pointer (validate() inside a constructor only reaches
+        // Object::accepts), so its constructors skip the call; descendents validate.
         explicit Object( PyObject *pyob=Py::_None(), bool owned = false )
         : p( pyob )
         {
@@ -178,7 +186,15 @@ namespace Py
             {
                 Py::_XINCREF( p );
             }
-            validate();
+        }
+
+        Object( PyObject *pyob, bool owned, prechecked_t )
+        : p( pyob )
+        {
+            if( !owned )
+            {
+                Py::_XINCREF( p );
+            }
         }
 
         // Copy constructor acquires new ownership of pointer
@@ -186,7 +202,13 @@ namespace Py
         : p( ob.p )
         {
             Py::_XINCREF( p );
-            validate();
+        }
+
+        // Move constructor steals the pointer, the source is left holding NULL
+        Object( Object &&ob ) noexcept
+        : p( ob.p )
+        {
+            ob.p = NULL;
         }
 
         // Assignment acquires new ownership of pointer
@@ -196,6 +218,19 @@ namespace Py
             return *this;
         }
 
+        // Move assignment steals the pointer without revalidating it: the
+        // implicit move of a descendent only ever passes the same wrapper type
+        Object &operator=( Object &&rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                release();
+                p = rhs.p;
+                rhs.p = NULL;
+            }
+            return *this;
+        }
+
         Object &operator=( PyObject *rhsp )
         {
             if( ptr() != rhsp )
@@ -454,6 +489,73 @@ namespace Py
         return p;
     }
 
+    // Convert between wrappers whose type the caller already knows, without
+    // running validate(). T must provide the prechecked_t constructor.
+    template<TEMPLATE_TYPENAME T>
+    inline T prechecked_cast( const Object &ob )
+    {
+        return T( ob.ptr(), false, prechecked_t() );
+    }
+
+    // Borrowed view of a wrapper of type T: the const member API through
+    // -> and *, without reference counting or validation. The object must
+    // outlive the view (e.g. a call argument inside the callback); copy
+    // *view into a T to keep it or to modify the wrapper. Views can be
+    // moved but not copied. T must provide the prechecked_t constructor.
+    template<TEMPLATE_TYPENAME T>
+    class Borrowed
+    {
+        static_assert( std::is_constructible<T, PyObject *, bool, prechecked_t>::value,
+                       "Borrowed<T> requires a T( PyObject *, bool, prechecked_t ) constructor" );
+
+    public:
+        Borrowed()
+        {
+            new( &value ) T( NULL, true, prechecked_t() );
+        }
+
+        explicit Borrowed( PyObject *pyob )
+        {
+            new( &value ) T( pyob, true, prechecked_t() );
+        }
+
+        Borrowed( Borrowed &&other ) noexcept
+        {
+            new( &value ) T( other.ptr(), true, prechecked_t() );
+        }
+
+        Borrowed &operator=( Borrowed &&other ) noexcept
+        {
+            // The wrapper holds no reference, so it is rebuilt in place
+            new( &value ) T( other.ptr(), true, prechecked_t() );
+            return *this;
+        }
+
+        Borrowed( const Borrowed & ) = delete;
+        Borrowed &operator=( const Borrowed & ) = delete;
+
+        // Never destroy value: that would release a reference it does not own
+        ~Borrowed()
+        {}
+
+        // Const access only: assigning through a mutable T& would release
+        // a reference the view never owned
+        const T *operator->() const { return &value; }
+        const T &operator*() const  { return value; }
+        operator const T &() const  { return value; }
+
+        PyObject *ptr() const
+        {
+            return value.ptr();
+        }
+
+    private:
+        union
+        {
+            T value;
+        };
+    };
+
     // Python special None value
     inline Object None()
     {
@@ -486,16 +588,34 @@ namespace Py
             validate();
         }
 
+        Type( PyObject *pyob, bool owned, prechecked_t tag )
+        : Object( pyob, owned, tag )
+        {}
+
         Type( const Object &ob )
         : Object( *ob )
         {
             validate();
         }
 
+        // The source has already been validated
         Type( const Type &t )
         : Object( t )
+        {}
+
+        Type( Type &&t ) noexcept
+        : Object( std::move( t ) )
+        {}
+
+        Type &operator=( const Type &rhs )
         {
-            validate();
+            return *this = *rhs;
+        }
+
+        Type &operator=( Type &&rhs ) noexcept
+        {
+            Object::operator=( std::move( rhs ) );
+            return *this;
         }
 
         Type &operator=( const Object &rhs )
@@ -528,10 +648,24 @@ namespace Py
             validate();
         }
 
+        // The source has already been validated
         Boolean( const Boolean &ob )
         : Object( *ob )
+        {}
+
+        Boolean( Boolean &&ob ) noexcept
+        : Object( std::move( ob ) )
+        {}
+
+        Boolean &operator=( const Boolean &rhs )
         {
-            validate();
+            return *this = *rhs;
+        }
+
+        Boolean &operator=( Boolean &&rhs ) noexcept
+        {
+            Object::operator=( std::move( rhs ) );
+            return *this;
         }
 
         // create from bool
@@ -591,10 +725,28 @@ namespace Py
             validate();
         }
 
+        Long( PyObject *pyob, bool owned, prechecked_t tag )
+        : Object( pyob, owned, tag )
+        {}
+
+        // The source has already been validated
         Long( const Long &ob )
         : Object( ob.ptr() )
+        {}
+
+        Long( Long &&ob ) noexcept
+        : Object( std::move( ob ) )
+        {}
+
+        Long &operator=( const Long &rhs )
         {
-            validate();
+            return *this = *rhs;
+        }
+
+        Long &operator=( Long &&rhs ) noexcept
+        {
+            Object::operator=( std::move( rhs ) );
+            return *this;
         }
 
         // try to create from any object
@@ -868,10 +1020,28 @@ namespace Py
             validate();
         }
 
+        Float( PyObject *pyob, bool owned, prechecked_t tag )
+        : Object( pyob, owned, tag )
+        {}
+
+        // The source has already been validated
         Float( const Float &f )
         : Object( f )
+        {}
+
+        Float( Float &&f ) noexcept
+        : Object( std::move( f ) )
+        {}
+
+        Float &operator=( const Float &rhs )
         {
-            validate();
+            return *this = *rhs;
+        }
+
+        Float &operator=( Float &&rhs ) noexcept
+        {
+            Object::operator=( std::move( rhs ) );
+            return *this;
         }
 
         // make from double
@@ -981,10 +1151,24 @@ namespace Py
             validate();
         }
 
+        // The source has already been validated
         Complex( const Complex &f )
         : Object( f )
+        {}
+
+        Complex( Complex &&f ) noexcept
+        : Object( std::move( f ) )
+        {}
+
+        Complex &operator=( const Complex &rhs )
         {
-            validate();
+            return *this = *rhs;
+        }
+
+        Complex &operator=( Complex &&rhs ) noexcept
+        {
+            Object::operator=( std::move( rhs ) );
+            return *this;
         }
 
         // make from double
@@ -1333,6 +1517,10 @@ namespace Py
             validate();
         }
 
+        SeqBase( PyObject *pyob, bool owned, prechecked_t tag )
+        : Object( pyob, owned, tag )
+        {}
+
         SeqBase( const Object &ob )
         : Object( ob )
         {
@@ -1875,6 +2063,10 @@ namespace Py
             validate();
         }
 
+        Bytes( PyObject *pyob, bool owned, prechecked_t tag )
+        : SeqBase<Byte>( pyob, owned, tag )
+        {}
+
         Bytes( const Object &ob )
         : SeqBase<Byte>( ob )
         {
@@ -2083,6 +2275,10 @@ namespace Py
             validate();
         }
 
+        String( PyObject *pyob, bool owned, prechecked_t tag )
+        : SeqBase<Char>( pyob, owned, tag )
+        {}
+
         String( const Object &ob )
         : SeqBase<Char>( ob )
         {
@@ -2277,6 +2473,10 @@ namespace Py
             validate();
         }
 
+        Tuple( PyObject *pyob, bool owned, prechecked_t tag )
+        : Sequence( pyob, owned, tag )
+        {}
+
         Tuple( const Object &ob )
         : Sequence( ob )
         {
@@ -2461,6 +2661,10 @@ namespace Py
         {
             validate();
         }
+
+        List( PyObject *pyob, bool owned, prechecked_t tag )
+        : Sequence( pyob, owned, tag )
+        {}
         List( const Object &ob )
         : Sequence( ob )
         {
@@ -2779,6 +2983,10 @@ namespace Py
             validate();
         }
 
+        MapBase( PyObject *pyob, bool owned, prechecked_t tag )
+        : Object( pyob, owned, tag )
+        {}
+
         // TMM: 02Jul'01 - changed MapBase<T> to Object in next line
         MapBase( const Object &ob )
         : Object( ob )
@@ -3182,6 +3390,10 @@ namespace Py
             validate();
         }
 
+        Dict( PyObject *pyob, bool owned, prechecked_t tag )
+        : Mapping( pyob, owned, tag )
+        {}
+
         Dict( const Object &ob )
         : Mapping( ob )
         {
@@ -3228,6 +3440,10 @@ namespace Py
             validate();
         }
 
+        Callable( PyObject *pyob, bool owned, prechecked_t tag )
+        : Object( pyob, owned, tag )
+        {}
+
         Callable( const Object &ob )
         : Object( ob )
         {
@@ -3322,6 +3538,10 @@ namespace Py
             validate();
         }
 
+        Module( PyObject *pyob, bool owned, prechecked_t tag )
+        : Object( pyob, owned, tag )
+        {}
+
         // Construct from module name
         explicit Module( const std::string &s )
         : Object()
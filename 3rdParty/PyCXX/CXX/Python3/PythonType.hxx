@@ -196,8 +196,31 @@ namespace Py
         PythonType &set_tp_dealloc( void (*tp_dealloc)( PyObject * ) );
         PythonType &set_tp_init( int (*tp_init)( PyObject *self, PyObject *args, PyObject *kwds ) );
         PythonType &set_tp_new( PyObject *(*tp_new)( PyTypeObject *subtype, PyObject *args, PyObject *kwds ) );
+#if !defined( Py_LIMITED_API )
+        // called instead of tp_new + tp_init when the type itself is called, not inherited
+        PythonType &set_tp_vectorcall( vectorcallfunc tp_vectorcall );
+#endif
         PythonType &set_methods( PyMethodDef *methods );
 
+        // install a function in the slot with the Py_<slot> id of PyType_Slot,
+        // the number, sequence and mapping tables are created as needed.
+        // Functions are checked against the signature of the slot, a mismatch
+        // throws TypeError; the void * form is unchecked and meant for data
+        // slots such as Py_tp_getset.
+        PythonType &set_slot( int slot, void *pfunc );
+        PythonType &set_slot( int slot, unaryfunc pfunc );
+        PythonType &set_slot( int slot, binaryfunc pfunc );
+        PythonType &set_slot( int slot, ternaryfunc pfunc );
+        PythonType &set_slot( int slot, inquiry pfunc );
+        PythonType &set_slot( int slot, lenfunc pfunc );    // also hashfunc
+        PythonType &set_slot( int slot, ssizeargfunc pfunc );
+        PythonType &set_slot( int slot, ssizeobjargproc pfunc );
+        PythonType &set_slot( int slot, objobjargproc pfunc );
+        PythonType &set_slot( int slot, objobjproc pfunc );
+        PythonType &set_slot( int slot, richcmpfunc pfunc );
+        PythonType &set_slot( int slot, getbufferproc pfunc );
+        PythonType &set_slot( int slot, releasebufferproc pfunc );
+
         // call once all support functions have been called to ready the type
         bool readyType();
 
@@ -215,6 +238,9 @@ namespace Py
 #endif
 
     private:
+        // set_slot after checking that slot is one of the 0 terminated ids
+        PythonType &set_typed_slot( int slot, const int *ids, void *pfunc, const char *signature );
+
         //
         // prevent the compiler generating these unwanted functions
         //
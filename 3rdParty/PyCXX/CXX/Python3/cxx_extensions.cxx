@@ -205,6 +205,23 @@ void ExtensionModuleBase::initialize( const char *module_doc )
     m_module = PyModule_Create( &m_module_def );
 }
 
+StaticModuleDef::StaticModuleDef( const char *name, const char *doc, PyMethodDef *methods )
+{
+    memset( &m_module_def, 0, sizeof( m_module_def ) );
+
+    m_module_def.m_name = name;
+    m_module_def.m_doc = doc;
+    m_module_def.m_methods = methods;
+}
+
+PyObject *StaticModuleDef::create()
+{
+    // init the exception code
+    initExceptions();
+
+    return PyModule_Create( &m_module_def );
+}
+
 Module ExtensionModuleBase::module( void ) const
 {
     return Module( m_module );
@@ -355,13 +372,13 @@ bool PythonType::readyType()
 
 PythonType &PythonType::supportSequenceType( int methods_to_support ) {
 #if !defined( Py_LIMITED_API )
-    if(sequence_table)
+    // the table may already exist from set_slot
+    if( !sequence_table )
     {
-        return *this;
+        sequence_table = new PySequenceMethods;
+        memset( sequence_table, 0, sizeof( PySequenceMethods ) );   // ensure new fields are 0
+        table->tp_as_sequence = sequence_table;
     }
-    sequence_table = new PySequenceMethods;
-    memset( sequence_table, 0, sizeof( PySequenceMethods ) );   // ensure new fields are 0
-    table->tp_as_sequence = sequence_table;
 #endif
 
     FILL_SEQUENCE_SLOT(length)
@@ -392,13 +409,13 @@ PythonType &PythonType::supportSequenceType( int methods_to_support ) {
 PythonType &PythonType::supportMappingType( int methods_to_support )
 {
 #if !defined( Py_LIMITED_API )
-    if( mapping_table )
+    // the table may already exist from set_slot
+    if( !mapping_table )
     {
-        return *this;
+        mapping_table = new PyMappingMethods;
+        memset( mapping_table, 0, sizeof( PyMappingMethods ) );   // ensure new fields are 0
+        table->tp_as_mapping = mapping_table;
     }
-    mapping_table = new PyMappingMethods;
-    memset( mapping_table, 0, sizeof( PyMappingMethods ) );   // ensure new fields are 0
-    table->tp_as_mapping = mapping_table;
 #endif
     FILL_MAPPING_SLOT(length)
     FILL_MAPPING_SLOT(subscript)
@@ -431,13 +448,13 @@ PythonType &PythonType::supportMappingType( int methods_to_support )
 PythonType &PythonType::supportNumberType( int methods_to_support, int inplace_methods_to_support )
 {
 #if !defined( Py_LIMITED_API )
-    if( number_table )
+    // the table may already exist from set_slot
+    if( !number_table )
     {
-        return *this;
+        number_table = new PyNumberMethods;
+        memset( number_table, 0, sizeof( PyNumberMethods ) );   // ensure new fields are 0
+        table->tp_as_number = number_table;
     }
-    number_table = new PyNumberMethods;
-    memset( number_table, 0, sizeof( PyNumberMethods ) );   // ensure new fields are 0
-    table->tp_as_number = number_table;
 #endif
 
     FILL_NUMBER_SLOT(add)
@@ -488,20 +505,21 @@ PythonType &PythonType::supportNumberType( int methods_to_support, int inplace_m
 #if !defined( Py_LIMITED_API )
 PythonType &PythonType::supportBufferType( int methods_to_support )
 {
+    // the table may already exist from set_slot
     if( !buffer_table )
     {
         buffer_table = new PyBufferProcs;
         memset( buffer_table, 0, sizeof( PyBufferProcs ) );   // ensure new fields are 0
         table->tp_as_buffer = buffer_table;
+    }
 
-        if( methods_to_support&support_buffer_getbuffer )
-        {
-            buffer_table->bf_getbuffer = buffer_get_handler;
-        }
-        if( methods_to_support&support_buffer_releasebuffer )
-        {
-            buffer_table->bf_releasebuffer = buffer_release_handler;
-        }
+    if( methods_to_support&support_buffer_getbuffer )
+    {
+        buffer_table->bf_getbuffer = buffer_get_handler;
+    }
+    if( methods_to_support&support_buffer_releasebuffer )
+    {
+        buffer_table->bf_releasebuffer = buffer_release_handler;
     }
     return *this;
 }
@@ -721,6 +739,14 @@ PythonType &PythonType::set_tp_new( PyObject *(*tp_new)( PyTypeObject *subtype,
     return *this;
 }
 
+#if !defined( Py_LIMITED_API )
+PythonType &PythonType::set_tp_vectorcall( vectorcallfunc tp_vectorcall )
+{
+    table->tp_vectorcall = tp_vectorcall;
+    return *this;
+}
+#endif
+
 PythonType &PythonType::set_methods( PyMethodDef *methods )
 {
 #if defined( Py_LIMITED_API )
@@ -731,6 +757,219 @@ PythonType &PythonType::set_methods( PyMethodDef *methods )
     return *this;
 }
 
+#if !defined( Py_LIMITED_API )
+#define SET_SLOT(id, field) \
+    case id: \
+        field = reinterpret_cast<decltype( field )>( pfunc ); \
+        break;
+#endif
+
+PythonType &PythonType::set_slot( int slot, void *pfunc )
+{
+#if defined( Py_LIMITED_API )
+    slots[ slot ] = pfunc;
+#else
+    bool number_slot = ( slot >= Py_nb_absolute && slot <= Py_nb_xor )
+                    || slot == Py_nb_matrix_multiply || slot == Py_nb_inplace_matrix_multiply;
+    if( number_slot && !number_table )
+    {
+        number_table = new PyNumberMethods;
+        memset( number_table, 0, sizeof( PyNumberMethods ) );
+        table->tp_as_number = number_table;
+    }
+    if( slot >= Py_sq_ass_item && slot <= Py_sq_repeat && !sequence_table )
+    {
+        sequence_table = new PySequenceMethods;
+        memset( sequence_table, 0, sizeof( PySequenceMethods ) );
+        table->tp_as_sequence = sequence_table;
+    }
+    if( slot >= Py_mp_ass_subscript && slot <= Py_mp_subscript && !mapping_table )
+    {
+        mapping_table = new PyMappingMethods;
+        memset( mapping_table, 0, sizeof( PyMappingMethods ) );
+        table->tp_as_mapping = mapping_table;
+    }
+
+    if( ( slot == Py_bf_getbuffer || slot == Py_bf_releasebuffer ) && !buffer_table )
+    {
+        buffer_table = new PyBufferProcs;
+        memset( buffer_table, 0, sizeof( PyBufferProcs ) );
+        table->tp_as_buffer = buffer_table;
+    }
+
+    switch( slot )
+    {
+    SET_SLOT( Py_bf_getbuffer, buffer_table->bf_getbuffer )
+    SET_SLOT( Py_bf_releasebuffer, buffer_table->bf_releasebuffer )
+    SET_SLOT( Py_mp_ass_subscript, mapping_table->mp_ass_subscript )
+    SET_SLOT( Py_mp_length, mapping_table->mp_length )
+    SET_SLOT( Py_mp_subscript, mapping_table->mp_subscript )
+    SET_SLOT( Py_nb_absolute, number_table->nb_absolute )
+    SET_SLOT( Py_nb_add, number_table->nb_add )
+    SET_SLOT( Py_nb_and, number_table->nb_and )
+    SET_SLOT( Py_nb_bool, number_table->nb_bool )
+    SET_SLOT( Py_nb_divmod, number_table->nb_divmod )
+    SET_SLOT( Py_nb_float, number_table->nb_float )
+    SET_SLOT( Py_nb_floor_divide, number_table->nb_floor_divide )
+    SET_SLOT( Py_nb_index, number_table->nb_index )
+    SET_SLOT( Py_nb_inplace_add, number_table->nb_inplace_add )
+    SET_SLOT( Py_nb_inplace_and, number_table->nb_inplace_and )
+    SET_SLOT( Py_nb_inplace_floor_divide, number_table->nb_inplace_floor_divide )
+    SET_SLOT( Py_nb_inplace_lshift, number_table->nb_inplace_lshift )
+    SET_SLOT( Py_nb_inplace_multiply, number_table->nb_inplace_multiply )
+    SET_SLOT( Py_nb_inplace_or, number_table->nb_inplace_or )
+    SET_SLOT( Py_nb_inplace_power, number_table->nb_inplace_power )
+    SET_SLOT( Py_nb_inplace_remainder, number_table->nb_inplace_remainder )
+    SET_SLOT( Py_nb_inplace_rshift, number_table->nb_inplace_rshift )
+    SET_SLOT( Py_nb_inplace_subtract, number_table->nb_inplace_subtract )
+    SET_SLOT( Py_nb_inplace_true_divide, number_table->nb_inplace_true_divide )
+    SET_SLOT( Py_nb_inplace_xor, number_table->nb_inplace_xor )
+    SET_SLOT( Py_nb_int, number_table->nb_int )
+    SET_SLOT( Py_nb_invert, number_table->nb_invert )
+    SET_SLOT( Py_nb_lshift, number_table->nb_lshift )
+    SET_SLOT( Py_nb_multiply, number_table->nb_multiply )
+    SET_SLOT( Py_nb_negative, number_table->nb_negative )
+    SET_SLOT( Py_nb_or, number_table->nb_or )
+    SET_SLOT( Py_nb_positive, number_table->nb_positive )
+    SET_SLOT( Py_nb_power, number_table->nb_power )
+    SET_SLOT( Py_nb_remainder, number_table->nb_remainder )
+    SET_SLOT( Py_nb_rshift, number_table->nb_rshift )
+    SET_SLOT( Py_nb_subtract, number_table->nb_subtract )
+    SET_SLOT( Py_nb_true_divide, number_table->nb_true_divide )
+    SET_SLOT( Py_nb_xor, number_table->nb_xor )
+    SET_SLOT( Py_sq_ass_item, sequence_table->sq_ass_item )
+    SET_SLOT( Py_sq_concat, sequence_table->sq_concat )
+    SET_SLOT( Py_sq_contains, sequence_table->sq_contains )
+    SET_SLOT( Py_sq_inplace_concat, sequence_table->sq_inplace_concat )
+    SET_SLOT( Py_sq_inplace_repeat, sequence_table->sq_inplace_repeat )
+    SET_SLOT( Py_sq_item, sequence_table->sq_item )
+    SET_SLOT( Py_sq_length, sequence_table->sq_length )
+    SET_SLOT( Py_sq_repeat, sequence_table->sq_repeat )
+    SET_SLOT( Py_tp_call, table->tp_call )
+    SET_SLOT( Py_tp_getattro, table->tp_getattro )
+    SET_SLOT( Py_tp_getset, table->tp_getset )
+    SET_SLOT( Py_tp_hash, table->tp_hash )
+    SET_SLOT( Py_tp_iter, table->tp_iter )
+    SET_SLOT( Py_tp_iternext, table->tp_iternext )
+    SET_SLOT( Py_tp_repr, table->tp_repr )
+    SET_SLOT( Py_tp_richcompare, table->tp_richcompare )
+    SET_SLOT( Py_tp_setattro, table->tp_setattro )
+    SET_SLOT( Py_tp_str, table->tp_str )
+#if PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION >= 5
+    SET_SLOT( Py_nb_matrix_multiply, number_table->nb_matrix_multiply )
+    SET_SLOT( Py_nb_inplace_matrix_multiply, number_table->nb_inplace_matrix_multiply )
+#endif
+    default:
+        throw RuntimeError( "PythonType::set_slot: unsupported slot" );
+    }
+#endif
+    return *this;
+}
+
+#undef SET_SLOT
+
+PythonType &PythonType::set_typed_slot( int slot, const int *ids, void *pfunc, const char *signature )
+{
+    for( ; *ids != 0; ++ids )
+    {
+        if( *ids == slot )
+            return set_slot( slot, pfunc );
+    }
+    std::string message( "PythonType::set_slot: slot does not take a " );
+    message += signature;
+    throw TypeError( message );
+}
+
+PythonType &PythonType::set_slot( int slot, unaryfunc pfunc )
+{
+    static const int ids[] =
+    {
+        Py_nb_absolute, Py_nb_float, Py_nb_index, Py_nb_int, Py_nb_invert,
+        Py_nb_negative, Py_nb_positive, Py_tp_iter, Py_tp_iternext, Py_tp_repr,
+        Py_tp_str, 0
+    };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "unaryfunc" );
+}
+
+PythonType &PythonType::set_slot( int slot, binaryfunc pfunc )
+{
+    static const int ids[] =
+    {
+        Py_nb_add, Py_nb_and, Py_nb_divmod, Py_nb_floor_divide, Py_nb_inplace_add,
+        Py_nb_inplace_and, Py_nb_inplace_floor_divide, Py_nb_inplace_lshift,
+        Py_nb_inplace_multiply, Py_nb_inplace_or, Py_nb_inplace_remainder,
+        Py_nb_inplace_rshift, Py_nb_inplace_subtract, Py_nb_inplace_true_divide,
+        Py_nb_inplace_xor, Py_nb_lshift, Py_nb_multiply, Py_nb_or, Py_nb_remainder,
+        Py_nb_rshift, Py_nb_subtract, Py_nb_true_divide, Py_nb_xor,
+#if PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION >= 5
+        Py_nb_matrix_multiply, Py_nb_inplace_matrix_multiply,
+#endif
+        Py_mp_subscript, Py_sq_concat, Py_sq_inplace_concat, Py_tp_getattro, 0
+    };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "binaryfunc" );
+}
+
+PythonType &PythonType::set_slot( int slot, ternaryfunc pfunc )
+{
+    static const int ids[] = { Py_nb_power, Py_nb_inplace_power, Py_tp_call, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "ternaryfunc" );
+}
+
+PythonType &PythonType::set_slot( int slot, inquiry pfunc )
+{
+    static const int ids[] = { Py_nb_bool, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "inquiry" );
+}
+
+PythonType &PythonType::set_slot( int slot, lenfunc pfunc )
+{
+    // hashfunc has the same signature (Py_hash_t is Py_ssize_t)
+    static const int ids[] = { Py_sq_length, Py_mp_length, Py_tp_hash, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "lenfunc or hashfunc" );
+}
+
+PythonType &PythonType::set_slot( int slot, ssizeargfunc pfunc )
+{
+    static const int ids[] = { Py_sq_item, Py_sq_repeat, Py_sq_inplace_repeat, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "ssizeargfunc" );
+}
+
+PythonType &PythonType::set_slot( int slot, ssizeobjargproc pfunc )
+{
+    static const int ids[] = { Py_sq_ass_item, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "ssizeobjargproc" );
+}
+
+PythonType &PythonType::set_slot( int slot, objobjargproc pfunc )
+{
+    static const int ids[] = { Py_mp_ass_subscript, Py_tp_setattro, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "objobjargproc" );
+}
+
+PythonType &PythonType::set_slot( int slot, objobjproc pfunc )
+{
+    static const int ids[] = { Py_sq_contains, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "objobjproc" );
+}
+
+PythonType &PythonType::set_slot( int slot, richcmpfunc pfunc )
+{
+    static const int ids[] = { Py_tp_richcompare, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "richcmpfunc" );
+}
+
+PythonType &PythonType::set_slot( int slot, getbufferproc pfunc )
+{
+    static const int ids[] = { Py_bf_getbuffer, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "getbufferproc" );
+}
+
+PythonType &PythonType::set_slot( int slot, releasebufferproc pfunc )
+{
+    static const int ids[] = { Py_bf_releasebuffer, 0 };
+    return set_typed_slot( slot, ids, reinterpret_cast<void *>( pfunc ), "releasebufferproc" );
+}
+
 PythonType &PythonType::supportClass()
 {
 #if defined( Py_LIMITED_API )
@@ -12,15 +12,30 @@
 #ifndef BASE_PYARGUMENTS_H
 #define BASE_PYARGUMENTS_H
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <concepts>
+#include <condition_variable>
+#include <coroutine>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #ifndef PY_SSIZE_T_CLEAN
 #define PY_SSIZE_T_CLEAN
@@ -32,6 +47,7 @@
 
 #include "CXX/Objects.hxx"
 #include <Python.h>
+#include <structmember.h>
 
 // ┌──────────────────────────────────────────────────────────────────────────┐
 // │ Base::PyArgs Namespace                                                       │
@@ -40,6 +56,13 @@
 namespace Base::PyArgs
 {
 
+// Preallocated bytes/str result, see BytesBuilder and StringBuilder
+template <typename Storage>
+class OutputBuilder;
+
+template <typename T>
+class Generator;
+
 // ╔══════════════════════════════════════════════════════════════════════════╗
 // ║ Private implementation details                                           ║
 // ╚══════════════════════════════════════════════════════════════════════════╝
@@ -74,12 +97,26 @@ struct expand_value_types
     using value_type = decltype((type_list<> {} + ... + std::declval<typename Args::value_type>()));
 };
 
-// Concatenate all named argument types into a single list of types.
+// Arguments filled from the call context (*args, **kwargs) instead of a format unit
+template <typename T>
+concept is_capture_arg = requires { T::captured; };
+
+// Capture arguments taking the extra positional arguments (*args)
+template <typename T>
+concept is_var_args_arg = requires { T::var_args; };
+
+// Arguments producing a callback value: named arguments and capture arguments
+template <typename T>
+inline constexpr bool is_stored_arg_v = T::named || is_capture_arg<T>;
+
+// Concatenate all stored argument types into a single list of types.
 template <typename... Args>
 struct expand_arg_types
 {
     using type = decltype((type_list<> {} + ...
-                           + std::conditional_t<Args::named, type_list<Args>, type_list<>> {}));
+                           + std::conditional_t<is_stored_arg_v<Args>,
+                                                type_list<Args>,
+                                                type_list<>> {}));
 };
 
 // ┌──────────────────────────────────────────────────────────────────────────┐
@@ -226,18 +263,269 @@ inline void apply_get_helper(Parsed& parsed,
     if constexpr (Index < sizeof...(Args))
     {
         using arg_t = std::tuple_element_t<Index, std::tuple<Args...>>;
-        std::get<Index>(values) = arg_t::template get<Pos>(parsed);
+        if constexpr (!is_capture_arg<arg_t>)
+        {
+            std::get<Index>(values) = arg_t::template get<Pos>(parsed);
+        }
         apply_get_helper<Index + 1, Pos + arg_t::offset>(parsed, values, args);
     }
 }
 
-// Copy values from parsed to values calling its type::get
+// Copy values from parsed to values calling its type::get. Runs once per parse, so
+// a get may move out of parsed (Map, Record).
 template <typename... Args, typename Values, typename Parsed>
 inline void apply_gets(Parsed& parsed, Values& values, const std::tuple<Args...>* args = nullptr)
 {
     apply_get_helper(parsed, values, args);
 }
 
+// Keyword arguments of a call as received, borrowed: a dict (tp_call) or the kwnames
+// tuple with the values that follow the positionals (vectorcall)
+struct keyword_args
+{
+    PyObject* dict {};
+    PyObject* kwnames {};
+    PyObject* const* values {};
+
+    auto size() const -> Py_ssize_t
+    {
+        if (dict)
+        {
+            return PyDict_GET_SIZE(dict);
+        }
+        return kwnames ? PyTuple_GET_SIZE(kwnames) : 0;
+    }
+
+    // Borrowed value of the interned name, nullptr if absent (check PyErr_Occurred)
+    auto find(PyObject* name) const -> PyObject*
+    {
+        if (dict)
+        {
+            return PyDict_GetItemWithError(dict, name);
+        }
+        Py_ssize_t count = size();
+        for (Py_ssize_t i = 0; i < count; i++)
+        {
+            if (PyTuple_GET_ITEM(kwnames, i) == name)
+            {
+                return values[i];
+            }
+        }
+        // Keywords are usually interned, compare by value only if that failed
+        for (Py_ssize_t i = 0; i < count; i++)
+        {
+            if (PyUnicode_Compare(PyTuple_GET_ITEM(kwnames, i), name) == 0)
+            {
+                return values[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Entry at pos, then pos is advanced (like PyDict_Next)
+    auto next(Py_ssize_t& pos, PyObject*& key, PyObject*& value) const -> bool
+    {
+        if (dict)
+        {
+            return PyDict_Next(dict, &pos, &key, &value);
+        }
+        if (pos >= size())
+        {
+            return false;
+        }
+        key = PyTuple_GET_ITEM(kwnames, pos);
+        value = values[pos];
+        ++pos;
+        return true;
+    }
+};
+
+// Interned names of the declared keywords
+struct keyword_names
+{
+    PyObject* const* names {};
+    std::size_t size {};
+
+    // Whether key is one of the names
+    auto contains(PyObject* key) const -> bool
+    {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (names[i] == key)
+            {
+                return true;
+            }
+        }
+        if (!PyUnicode_Check(key))
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (PyUnicode_Compare(names[i], key) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Call data available to capture arguments
+struct call_context
+{
+    PyObject* const* args {};         // Positional arguments as received
+    Py_ssize_t nargs {};              // Number of positional arguments
+    Py_ssize_t consumed {};           // Positional arguments consumed by the format
+    keyword_args kwargs {};           // Keyword arguments as received
+    Py_ssize_t extra_keywords {};     // Keyword arguments not matching a declared keyword
+    keyword_names keywords {};        // Declared keywords
+};
+
+// Outcome of one match attempt: parsing failed, the callback failed, or both succeeded
+enum class match_status
+{
+    no_match,
+    failed,
+    done
+};
+
+// Fill capture argument values from the call context (helper)
+template <std::size_t Index = 0, typename... Args, typename Values>
+inline auto apply_capture_helper(const call_context& ctx,
+                                 Values& values,
+                                 const std::tuple<Args...>* args = nullptr) -> bool
+{
+    if constexpr (Index < sizeof...(Args))
+    {
+        using arg_t = std::tuple_element_t<Index, std::tuple<Args...>>;
+        if constexpr (is_capture_arg<arg_t>)
+        {
+            if (!arg_t::capture(ctx, std::get<Index>(values)))
+            {
+                return false;
+            }
+        }
+        return apply_capture_helper<Index + 1>(ctx, values, args);
+    }
+    return true;
+}
+
+// Fill capture argument values from the call context
+template <typename... Args, typename Values>
+inline auto apply_captures(const call_context& ctx,
+                           Values& values,
+                           const std::tuple<Args...>* args = nullptr) -> bool
+{
+    return apply_capture_helper(ctx, values, args);
+}
+
+// Owned Python reference released on scope exit
+struct decref_deleter
+{
+    void operator()(PyObject* obj) const noexcept { Py_XDECREF(obj); }
+};
+
+using py_owned = std::unique_ptr<PyObject, decref_deleter>;
+
+// Lock of a cache shared by the calls of a declaration, only needed without the GIL
+class cache_mutex
+{
+public:
+    void lock()
+    {
+#if defined(Py_GIL_DISABLED)
+        PyMutex_Lock(&mutex);
+#endif
+    }
+
+    void unlock()
+    {
+#if defined(Py_GIL_DISABLED)
+        PyMutex_Unlock(&mutex);
+#endif
+    }
+
+private:
+#if defined(Py_GIL_DISABLED)
+    PyMutex mutex {};
+#endif
+};
+
+// Interned names of the keywords of an Arguments type, one entry per keywords array.
+// Keywords are string literals, so entries are never replaced or released: their
+// number is bounded by the declarations in the program.
+template <std::size_t N>
+class keyword_cache
+{
+public:
+    using names_t = std::array<PyObject*, N>;
+
+    // Names of keywords, nullptr with an exception set if interning failed
+    auto find(const std::array<const char*, N + 1>& keywords) -> const names_t*
+    {
+        std::lock_guard<cache_mutex> guard {mutex};
+        for (const entry* e = head; e; e = e->next)
+        {
+            if (std::equal(e->keywords.begin(), e->keywords.end(), keywords.begin()))
+            {
+                return &e->names;
+            }
+        }
+
+        auto added = std::make_unique<entry>();
+        for (std::size_t i = 0; i < N; i++)
+        {
+            added->keywords[i] = keywords[i];
+            added->names[i] = PyUnicode_InternFromString(keywords[i]);
+            if (!added->names[i])
+            {
+                for (std::size_t j = 0; j < i; j++)
+                {
+                    Py_DECREF(added->names[j]);
+                }
+                return nullptr;
+            }
+        }
+        added->next = head;
+        head = added.release();
+        return &head->names;
+    }
+
+private:
+    struct entry
+    {
+        std::array<const char*, N> keywords {};
+        names_t names {};
+        const entry* next {};
+    };
+
+    const entry* head {};
+    cache_mutex mutex;
+};
+
+// Sets TypeError for the first key of kwargs that is not one of the keywords
+inline void set_unexpected_keyword(const keyword_args& kwargs, const keyword_names& keywords)
+{
+    PyObject* key = nullptr;
+    PyObject* value = nullptr;
+    Py_ssize_t pos = 0;
+    while (kwargs.next(pos, key, value))
+    {
+        if (!PyUnicode_Check(key))
+        {
+            PyErr_SetString(PyExc_TypeError, "keywords must be strings");
+            return;
+        }
+        if (!keywords.contains(key))
+        {
+            PyErr_Format(
+                PyExc_TypeError, "'%U' is an invalid keyword argument for this function", key);
+            return;
+        }
+    }
+}
+
 // ┌──────────────────────────────────────────────────────────────────────────┐
 // │ Argument utils                                                           │
 // └──────────────────────────────────────────────────────────────────────────┘
@@ -286,7 +574,7 @@ struct named_index_helper<Index, T, Rest...>
     template <std::size_t... I>
     static constexpr auto add_if_named(std::index_sequence<I...>)
     {
-        if constexpr (std::decay_t<T>::named)
+        if constexpr (is_stored_arg_v<std::decay_t<T>>)
         {
             return std::index_sequence<Index, I...> {};
         }
@@ -306,7 +594,7 @@ inline constexpr auto build_named_args_impl(std::tuple<Ts...>&& args, std::index
     return std::make_tuple(std::get<I>(args)...);
 }
 
-// Build a tuple of named arguments (similar to build_keywords but returns tuple of args)
+// Build a tuple of stored arguments (similar to build_keywords but returns tuple of args)
 template <typename... Ts>
 inline consteval auto build_named_args(Ts&&... args)
 {
@@ -322,6 +610,19 @@ struct marker_arg
     static constexpr bool named {false};
 };
 
+// Base type for capture arguments (values taken from the call context, no format unit)
+struct capture_arg
+{
+    using parse_type = type_list<>;
+    static constexpr bool named {false};
+    static constexpr bool captured {true};
+    static constexpr std::size_t offset = 0;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>&)
+    {}
+};
+
 // Return the appropriate pointer to pass to PyArg_ParseTupleAndKeywords
 template <typename T>
 inline constexpr auto parse_ptr(T&& obj)
@@ -371,275 +672,902 @@ inline auto PyArg_ParseTupleAndKeywords_Tuple(PyObject* args,
                                             std::index_sequence_for<Args...> {});
 }
 
-} // namespace detail
+// Single format unit parse of one object into the Count parse values at Pos
+template <std::size_t Pos, typename Tuple, std::size_t... I>
+inline auto PyArg_Parse_Impl(PyObject* obj,
+                             const char* fmt,
+                             Tuple& tup,
+                             std::index_sequence<I...>) -> int
+{
+    return PyArg_Parse(obj, fmt, parse_ptr(std::get<Pos + I>(tup))...);
+}
+
+template <std::size_t Pos, std::size_t Count, typename... Args>
+inline auto PyArg_Parse_Tuple(PyObject* obj, const char* fmt, std::tuple<Args...>& tup) -> int
+{
+    return PyArg_Parse_Impl<Pos>(obj, fmt, tup, std::make_index_sequence<Count> {});
+}
+
+// _PyArg_ParseStack is private, Python 3.13 no longer declares it in Python.h
+#if !defined(Py_LIMITED_API) && PY_VERSION_HEX < 0x030D0000
+// Positional-only parse straight from a vectorcall array, no tuple is built
+template <typename Tuple, std::size_t... I>
+inline auto PyArg_ParseStack_Impl(PyObject* const* args,
+                                  Py_ssize_t nargs,
+                                  const char* fmt,
+                                  Tuple&& tup,
+                                  std::index_sequence<I...>) -> int
+{
+    return _PyArg_ParseStack(args, nargs, fmt, parse_ptr(std::get<I>(std::forward<Tuple>(tup)))...);
+}
+
+template <typename... Args>
+inline auto PyArg_ParseStack_Tuple(PyObject* const* args,
+                                   Py_ssize_t nargs,
+                                   const char* fmt,
+                                   const std::tuple<Args...>& tup) -> int
+{
+    return PyArg_ParseStack_Impl(args, nargs, fmt, tup, std::index_sequence_for<Args...> {});
+}
+#endif
 
 // ╔══════════════════════════════════════════════════════════════════════════╗
-// ║ Public API                                                               ║
+// ║ Value conversion                                                         ║
 // ╚══════════════════════════════════════════════════════════════════════════╝
 
-// c-string alias for readability
-using c_str_t = const char*;
+template <typename T>
+inline constexpr bool always_false_v = false;
 
-// ┌──────────────────────────────────────────────────────────────────────────┐
-// │ Constexpr string utils                                                   │
-// └──────────────────────────────────────────────────────────────────────────┘
+template <typename T>
+inline constexpr bool is_optional_v = false;
 
-// Compile time string
-template <std::size_t N>
-struct FmtString
-{
-    constexpr FmtString(const char (&str)[N])
-    {
-        std::copy(std::begin(str), std::end(str), std::begin(value));
-    }
+template <typename T>
+inline constexpr bool is_optional_v<std::optional<T>> = true;
 
-    constexpr FmtString() = default;
+template <typename T>
+inline constexpr bool is_vector_v = false;
 
-    char value[N] {};
-    static constexpr std::size_t size = N;
-};
+template <typename T, typename A>
+inline constexpr bool is_vector_v<std::vector<T, A>> = true;
 
-// Deduction guide to help the compiler
-template <std::size_t N>
-FmtString(const char (&)[N]) -> FmtString<N>;
+// Lazy Python iterator over a C++ range (see Generator)
+template <typename R>
+auto make_range_iterator(R&& range) -> PyObject*;
 
-// Total size
-template <typename... Fmts>
-inline constexpr std::size_t fmt_size = (0 + ... + (Fmts::size - 1)) + 1;
+template <typename T>
+inline constexpr bool is_generator_v = false;
 
-// Variadic constexpr function to concatenate FmtStrings in one pass
-template <typename... Fmts>
-inline consteval auto fmt_concat(Fmts... fmts)
-{
-    FmtString<fmt_size<Fmts...>> result {};
-    char* current_pos = result.value;
+template <typename T>
+inline constexpr bool is_generator_v<Generator<T>> = true;
 
-    // Use a lambda and C++17 fold expression to copy each string
-    auto copy_fmt = [&](const auto& fmt_str) {
-        for (std::size_t i = 0; i < fmt_str.size - 1; ++i)
-        { // Copy characters, excluding null terminator
-            *current_pos++ = fmt_str.value[i];
-        }
-    };
-    (copy_fmt(fmts), ...); // Apply copy_fmt to each FmtString in the pack
-    *current_pos = '\0';   // Null-terminate the final string
-    return result;
-}
+template <typename T>
+inline constexpr bool is_output_builder_v = false;
 
-// Base type of arguments with name (keyword)
-struct named_arg
-{
-    const char* name {};
-    static constexpr bool named {true};
-};
+template <typename Storage>
+inline constexpr bool is_output_builder_v<OutputBuilder<Storage>> = true;
 
-// Base type of arguments with default value
+// Convert a C++ value into a new Python reference.
+// Returns nullptr with a Python exception set on failure.
+// PyObject* values are taken as new references (ownership is transferred).
+// Generators and owning views moved in become lazy iterators, other ranges become lists.
 template <typename T>
-struct with_default
+inline auto to_python(T&& value) -> PyObject*;
+
+// New list with the converted items of range
+template <typename R>
+inline auto range_to_list(R&& range) -> PyObject*
 {
-    T default_value {};
-};
+    Py_ssize_t size = 0;
+    if constexpr (std::ranges::sized_range<R>)
+    {
+        size = static_cast<Py_ssize_t>(std::ranges::size(range));
+    }
+    PyObject* list = PyList_New(size);
+    if (!list)
+    {
+        return nullptr;
+    }
+    Py_ssize_t index = 0;
+    for (auto&& item : range)
+    {
+        PyObject* obj = to_python(std::forward<decltype(item)>(item));
+        if (!obj)
+        {
+            Py_DECREF(list);
+            return nullptr;
+        }
+        if constexpr (std::ranges::sized_range<R>)
+        {
+            PyList_SET_ITEM(list, index++, obj);
+        }
+        else if (PyList_Append(list, obj) < 0)
+        {
+            Py_DECREF(obj);
+            Py_DECREF(list);
+            return nullptr;
+        }
+        else
+        {
+            Py_DECREF(obj);
+        }
+    }
+    return list;
+}
 
-// Basic argument with a single parsed value
 template <typename T>
-struct value_arg
+inline auto to_python(T&& value) -> PyObject*
 {
-    static constexpr std::size_t offset = 1;
-
-    using value_type = detail::type_list<T>;
-    using parse_type = detail::type_list<T>;
+    using Type = std::remove_cvref_t<T>;
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple)
+    if constexpr (std::is_same_v<Type, bool>)
     {
-        std::get<Offset>(tuple) = T {};
+        return PyBool_FromLong(value ? 1 : 0);
     }
-
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple, const T& default_value)
+    else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
     {
-        std::get<Offset>(tuple) = default_value;
+        return PyLong_FromLongLong(static_cast<long long>(value));
     }
-
-    template <std::size_t Offset, typename... Args>
-    static constexpr auto get(std::tuple<Args...>& tuple) -> T
+    else if constexpr (std::is_integral_v<Type>)
     {
-        return std::get<Offset>(tuple);
+        return PyLong_FromUnsignedLongLong(static_cast<unsigned long long>(value));
     }
-};
-
-// ┌──────────────────────────────────────────────────────────────────────────┐
-// │ Marker Arguments                                                         │
-// └──────────────────────────────────────────────────────────────────────────┘
-
-// Marker of end of positional-only arguments (Not enforced)
-struct PosOnly
-{};
-
-// Marker of start of keyword-only arguments
-struct KwOnly
-{};
-
-// Marker of start of optional arguments
-struct Optional
-{};
+    else if constexpr (std::is_floating_point_v<Type>)
+    {
+        return PyFloat_FromDouble(static_cast<double>(value));
+    }
+    else if constexpr (std::is_same_v<Type, PyObject*>)
+    {
+        return value;
+    }
+    else if constexpr (is_optional_v<Type>)
+    {
+        return value ? to_python(*std::forward<T>(value)) : Py_NewRef(Py_None);
+    }
+    else if constexpr (std::is_base_of_v<::Py::Object, Type>)
+    {
+        return ::Py::new_reference_to(value);
+    }
+    else if constexpr (std::is_convertible_v<const Type&, std::string_view>)
+    {
+        std::string_view str {value};
+        return PyUnicode_FromStringAndSize(str.data(), static_cast<Py_ssize_t>(str.size()));
+    }
+    else if constexpr (is_output_builder_v<Type>)
+    {
+        return value.release();
+    }
+    else if constexpr (is_generator_v<Type>)
+    {
+        static_assert(!std::is_lvalue_reference_v<T>, "Generators are single pass, move them in");
+        return make_range_iterator(std::move(value));
+    }
+    else if constexpr (std::ranges::view<Type> && std::ranges::borrowed_range<Type>)
+    {
+        // span, subrange, ref_view...: the storage is not owned, copy it now
+        static_assert(!std::is_lvalue_reference_v<T>,
+                      "Borrowed views would dangle in Python, return a container or the view "
+                      "by value (converted to a list)");
+        return range_to_list(value);
+    }
+    else if constexpr (std::ranges::view<Type> && !std::is_lvalue_reference_v<T>)
+    {
+        // Owning view moved in: iterated lazily, the iterator keeps it
+        return make_range_iterator(std::move(value));
+    }
+    else if constexpr (std::ranges::input_range<Type>)
+    {
+        return range_to_list(value);
+    }
+    else
+    {
+        static_assert(always_false_v<Type>, "No Python conversion available for this type");
+    }
+}
 
-// Marker of Python boolean value
-struct Bool
-{};
+// Exact int to long long without the number protocol.
+// Returns false if obj is not an exact int or does not fit (no exception set).
+inline auto exact_long(PyObject* obj, long long& out) -> bool
+{
+    if (!PyLong_CheckExact(obj))
+    {
+        return false;
+    }
+#if PY_VERSION_HEX >= 0x030C0000
+    if (PyUnstable_Long_IsCompact(reinterpret_cast<PyLongObject*>(obj)))
+    {
+        out = PyUnstable_Long_CompactValue(reinterpret_cast<PyLongObject*>(obj));
+        return true;
+    }
+#endif
+    int overflow = 0;
+    out = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    return overflow == 0 && !(out == -1 && PyErr_Occurred());
+}
 
-// Python tuple
-struct Tuple
-{};
+// Store value in out if it fits T, OverflowError otherwise
+template <typename T, typename V>
+inline auto checked_integer(V value, T& out) -> bool
+{
+    if (!std::in_range<T>(value))
+    {
+        const char* message = "unsigned integer is greater than maximum";
+        if constexpr (std::is_signed_v<T>)
+        {
+            message = std::cmp_less(value, 0) ? "signed integer is less than minimum"
+                                              : "signed integer is greater than maximum";
+        }
+        PyErr_SetString(PyExc_OverflowError, message);
+        return false;
+    }
+    out = static_cast<T>(value);
+    return true;
+}
 
-// Python Dict
-struct Dict
-{};
+// Convert a Python object into a C++ value.
+// Returns false with a Python exception set on failure.
+// Views (std::string_view, c-strings, PyObject*) borrow from obj.
+// Exact builtins (True/False, int, float) are checked first, the generic
+// __bool__/__index__/__float__ protocols only run when those fail.
+template <typename T>
+inline auto from_python(PyObject* obj, T& out) -> bool
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        if (obj == Py_True || obj == Py_False)
+        {
+            out = obj == Py_True;
+            return true;
+        }
+        int value = PyObject_IsTrue(obj);
+        out = value > 0;
+        return value >= 0;
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        long long value = 0;
+        if (!exact_long(obj, value))
+        {
+            value = PyLong_AsLongLong(obj);
+            if (value == -1 && PyErr_Occurred())
+            {
+                return false;
+            }
+        }
+        return checked_integer(value, out);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        long long exact = 0;
+        if (exact_long(obj, exact) && exact >= 0)
+        {
+            return checked_integer(exact, out);
+        }
+        if (!PyLong_Check(obj))
+        {
+            PyErr_Format(PyExc_TypeError, "expected int, got %.200s", Py_TYPE(obj)->tp_name);
+            return false;
+        }
+        unsigned long long value = PyLong_AsUnsignedLongLong(obj);
+        if (value == static_cast<unsigned long long>(-1) && PyErr_Occurred())
+        {
+            return false;
+        }
+        return checked_integer(value, out);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        if (PyFloat_CheckExact(obj))
+        {
+            out = static_cast<T>(PyFloat_AS_DOUBLE(obj));
+            return true;
+        }
+        double value = PyFloat_AsDouble(obj);
+        if (value == -1.0 && PyErr_Occurred())
+        {
+            return false;
+        }
+        out = static_cast<T>(value);
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, PyObject*>)
+    {
+        out = obj;
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+    {
+        Py_ssize_t size = 0;
+        const char* data = PyUnicode_AsUTF8AndSize(obj, &size);
+        if (!data)
+        {
+            return false;
+        }
+        out = T {data, static_cast<std::size_t>(size)};
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, const char*>)
+    {
+        out = PyUnicode_AsUTF8(obj);
+        return out != nullptr;
+    }
+    else if constexpr (is_optional_v<T>)
+    {
+        // None by identity, before any conversion
+        if (obj == Py_None)
+        {
+            out.reset();
+            return true;
+        }
+        typename T::value_type value {};
+        if (!from_python(obj, value))
+        {
+            return false;
+        }
+        out = std::move(value);
+        return true;
+    }
+    else if constexpr (is_vector_v<T>)
+    {
+        using item_t = typename T::value_type;
+        static_assert(!std::is_same_v<item_t, std::string_view>
+                          && !std::is_same_v<item_t, const char*>,
+                      "Items of generic sequences may be temporary, use std::string");
 
-// Python Py_ssize_t
-struct SSize
-{};
+        PyObject* seq = PySequence_Fast(obj, "expected a sequence");
+        if (!seq)
+        {
+            return false;
+        }
+        Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+        PyObject** items = PySequence_Fast_ITEMS(seq);
+        T result;
+        result.reserve(static_cast<std::size_t>(size));
+        for (Py_ssize_t i = 0; i < size; i++)
+        {
+            item_t item {};
+            if (!from_python(items[i], item))
+            {
+                Py_DECREF(seq);
+                return false;
+            }
+            result.push_back(std::move(item));
+        }
+        Py_DECREF(seq);
+        out = std::move(result);
+        return true;
+    }
+    else if constexpr (std::is_base_of_v<::Py::Object, T>)
+    {
+        // Check with accepts() first, T {obj} would throw from validate()
+        static_assert(std::is_constructible_v<T, PyObject*, bool, ::Py::prechecked_t>,
+                      "PyCXX wrappers need the prechecked_t constructor");
+        T checked {obj, false, ::Py::prechecked_t {}};
+        if (!checked.accepts(obj))
+        {
+            PyErr_Format(PyExc_TypeError, "unexpected %.200s object", Py_TYPE(obj)->tp_name);
+            return false;
+        }
+        out = checked;
+        return true;
+    }
+    else
+    {
+        static_assert(always_false_v<T>, "No C++ conversion available for this type");
+    }
+}
 
-// Non negative byte
-struct NNByte
-{};
+// "O&" converter based on from_python
+template <typename T>
+inline auto convert_value(PyObject* obj, void* out) -> int
+{
+    return from_python(obj, *static_cast<T*>(out)) ? 1 : 0;
+}
 
-// 1 byte  (bytes[1]) to char
-struct Byte1
-{};
+// Converter function for "O&" format units
+template <int (*Fn)(PyObject*, void*)>
+struct converter
+{
+    static constexpr auto parse_ptr_value() { return Fn; }
+};
 
-// 1 char (str) to int
-struct Char1
-{};
+// "O&" converter accepting any callable object (borrowed)
+inline auto convert_callable(PyObject* obj, void* out) -> int
+{
+    if (!PyCallable_Check(obj))
+    {
+        PyErr_Format(PyExc_TypeError, "expected a callable, got %.200s", Py_TYPE(obj)->tp_name);
+        return 0;
+    }
+    *static_cast<PyObject**>(out) = obj;
+    return 1;
+}
 
-// Filesystem Path
-struct FSPath
+// "O&" converter checking the type of a borrowed object. The exact type is
+// compared by pointer first; subclasses are accepted unless Exact is set.
+template <PyTypeObject* Type, bool Exact = false>
+inline auto check_type(PyObject* obj, void* out) -> int
 {
-    static constexpr auto parse_ptr_value() { return PyUnicode_FSConverter; }
-};
+    if (!Py_IS_TYPE(obj, Type) && (Exact || !PyType_IsSubtype(Py_TYPE(obj), Type)))
+    {
+        PyErr_Format(PyExc_TypeError,
+                     "expected %s%.200s, got %.200s",
+                     Exact ? "exactly " : "",
+                     Type->tp_name,
+                     Py_TYPE(obj)->tp_name);
+        return 0;
+    }
+    *static_cast<PyObject**>(out) = obj;
+    return 1;
+}
 
-// ┌──────────────────────────────────────────────────────────────────────────┐
-// │ Argument specializations                                                 │
-// └──────────────────────────────────────────────────────────────────────────┘
+// ╔══════════════════════════════════════════════════════════════════════════╗
+// ║ Async dispatch                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════╝
 
-// Validated python type
+// Callback values that own Python references (or need the GIL to be used). They cannot be
+// handed to a match_async callback, which runs and destroys its parameters without the GIL.
 template <typename T>
-struct Arg : named_arg
-{
-    using value_type = detail::type_list<T*>;
-    using parse_type = detail::type_list<PyTypeObject&, PyObject*>;
+inline constexpr bool gil_bound_v = std::is_base_of_v<::Py::Object, T>;
 
-    static constexpr PyTypeObject& py_type = T::Type;
-    static constexpr FmtString fmt {"O!"};
-    static constexpr std::size_t offset = 2;
+template <typename T>
+inline constexpr bool gil_bound_v<std::optional<T>> = gil_bound_v<T>;
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple)
+template <typename T>
+inline constexpr bool gil_bound_v<::Py::Borrowed<T>> = true;
+
+template <typename Tuple>
+inline constexpr bool any_gil_bound_v = false;
+
+template <typename... Ts>
+inline constexpr bool any_gil_bound_v<std::tuple<Ts...>> = (false || ... || gil_bound_v<Ts>);
+
+// Fixed set of worker threads running queued tasks in submission order
+class thread_pool
+{
+public:
+    explicit thread_pool(std::size_t size)
     {
-        std::get<Offset>(tuple) = py_type;
-        std::get<Offset + 1>(tuple) = nullptr;
+        try
+        {
+            workers.reserve(size);
+            for (std::size_t i = 0; i < size; i++)
+            {
+                workers.emplace_back([this] { work(); });
+            }
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
     }
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr auto get(std::tuple<Args...>& tuple) -> T*
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    // Runs the queued tasks, then joins the workers
+    ~thread_pool()
     {
-        return static_cast<T*>(std::get<Offset + 1>(tuple));
+        stop();
     }
-};
-
-// Python tuple
-template <>
-struct Arg<Tuple> : named_arg
-{
-    using value_type = detail::type_list<PyTupleObject*>;
-    using parse_type = detail::type_list<PyTypeObject&, PyTupleObject*>;
 
-    static constexpr FmtString fmt {"O!"};
-    static constexpr std::size_t offset = 2;
+    // Pool shared by match_async calls, one worker per hardware thread. Never destroyed:
+    // joining at exit would wait for tasks blocked on the GIL of a finalized interpreter.
+    static auto shared() -> thread_pool&
+    {
+        static auto* pool = new thread_pool(std::max(1u, std::thread::hardware_concurrency()));
+        return *pool;
+    }
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple)
+    auto size() const noexcept -> std::size_t
     {
-        std::get<Offset>(tuple) = PyTuple_Type;
-        std::get<Offset + 1>(tuple) = nullptr;
+        return workers.size();
     }
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr auto get(std::tuple<Args...>& tuple) -> PyTupleObject*
+    // Queue a move-only task, throws std::bad_alloc without having queued it
+    template <typename Task>
+    void submit(Task&& task)
     {
-        return static_cast<PyTupleObject*>(std::get<Offset + 1>(tuple));
+        auto job = std::make_unique<job_impl<std::decay_t<Task>>>(std::forward<Task>(task));
+        {
+            std::lock_guard<std::mutex> guard {mutex};
+            queue.push_back(std::move(job));
+        }
+        ready.notify_one();
     }
-};
 
-// Python dict
-template <>
-struct Arg<Dict> : named_arg
-{
-    using value_type = detail::type_list<PyDictObject*>;
-    using parse_type = detail::type_list<PyTypeObject&, PyDictObject*>;
+private:
+    struct job
+    {
+        virtual ~job() = default;
+        virtual void run() = 0;
+    };
 
-    static constexpr FmtString fmt {"O!"};
-    static constexpr std::size_t offset = 2;
+    template <typename Task>
+    struct job_impl final : job
+    {
+        template <typename T>
+        explicit job_impl(T&& fn) : task(std::forward<T>(fn))
+        {}
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple)
+        void run() override
+        {
+            task();
+        }
+        Task task;
+    };
+
+    void stop()
     {
-        std::get<Offset>(tuple) = PyDict_Type;
-        std::get<Offset + 1>(tuple) = nullptr;
+        {
+            std::lock_guard<std::mutex> guard {mutex};
+            stopping = true;
+        }
+        ready.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
     }
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr auto get(std::tuple<Args...>& tuple) -> PyDictObject*
+    void work()
     {
-        return static_cast<PyDictObject*>(std::get<Offset + 1>(tuple));
+        for (;;)
+        {
+            std::unique_ptr<job> next;
+            {
+                std::unique_lock<std::mutex> lock {mutex};
+                ready.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (queue.empty())
+                {
+                    return;
+                }
+                next = std::move(queue.front());
+                queue.pop_front();
+            }
+            next->run();
+        }
     }
-};
 
-// Position-only marker (not supported by PyArg_ParseTupleAndKeywords so does nothing by now)
-template <>
-struct Arg<PosOnly> : detail::marker_arg
-{
-    static constexpr FmtString fmt {""};
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::unique_ptr<job>> queue;
+    std::vector<std::thread> workers;
+    bool stopping {};
 };
 
-// Keyword-only marker
-template <>
-struct Arg<KwOnly> : detail::marker_arg
+// Default executor for match_async: queues the task on the shared thread pool
+struct pool_executor
 {
-    static constexpr FmtString fmt {"$"};
+    template <typename Task>
+    void operator()(Task&& task) const
+    {
+        thread_pool::shared().submit(std::forward<Task>(task));
+    }
 };
 
-// Optional marker
-template <>
-struct Arg<Optional> : detail::marker_arg
+// Create a concurrent.futures.Future (new reference)
+inline auto new_future() -> PyObject*
 {
-    static constexpr FmtString fmt {"|"};
-};
+    PyObject* module = PyImport_ImportModule("concurrent.futures");
+    if (!module)
+    {
+        return nullptr;
+    }
+    PyObject* future = PyObject_CallMethod(module, "Future", nullptr);
+    Py_DECREF(module);
+    return future;
+}
 
-// byte argument
-template <>
-struct Arg<NNByte> : named_arg, with_default<unsigned char>, value_arg<unsigned char>
+// If an asyncio loop is running in this thread, wrap the future so it can be awaited.
+// Otherwise return the concurrent future itself (new reference in both cases).
+inline auto awaitable_future(PyObject* future) -> PyObject*
 {
-    static constexpr FmtString fmt {"b"};
-};
+    PyObject* name = PyUnicode_FromString("asyncio");
+    if (!name)
+    {
+        return nullptr;
+    }
+    PyObject* asyncio = PyImport_GetModule(name);
+    Py_DECREF(name);
+    if (!asyncio)
+    {
+        return PyErr_Occurred() ? nullptr : Py_NewRef(future);
+    }
 
-template <>
-struct Arg<unsigned char> : named_arg, with_default<unsigned char>, value_arg<unsigned char>
-{
-    static constexpr FmtString fmt {"B"};
-};
+    PyObject* result = nullptr;
+    if (PyObject* loop = PyObject_CallMethod(asyncio, "_get_running_loop", nullptr))
+    {
+        result = loop == Py_None
+            ? Py_NewRef(future)
+            : PyObject_CallMethod(asyncio, "wrap_future", "O", future);
+        Py_DECREF(loop);
+    }
+    Py_DECREF(asyncio);
+    return result;
+}
 
-// short argument
-template <>
-struct Arg<short> : named_arg, with_default<short>, value_arg<short>
+// Resolve a future with a value (new reference, stolen) or with the current Python error.
+// The GIL must be held.
+inline void resolve_future(PyObject* future, PyObject* value)
 {
-    static constexpr FmtString fmt {"h"};
-};
+    PyObject* result = nullptr;
+    if (value)
+    {
+        result = PyObject_CallMethod(future, "set_result", "O", value);
+        Py_DECREF(value);
+    }
+    else
+    {
+        PyObject* type = nullptr;
+        PyObject* error = nullptr;
+        PyObject* traceback = nullptr;
+        PyErr_Fetch(&type, &error, &traceback);
+        PyErr_NormalizeException(&type, &error, &traceback);
+        if (error && traceback)
+        {
+            PyException_SetTraceback(error, traceback);
+        }
+        result = PyObject_CallMethod(future, "set_exception", "O", error ? error : Py_None);
+        Py_XDECREF(type);
+        Py_XDECREF(error);
+        Py_XDECREF(traceback);
+    }
 
-template <>
-struct Arg<unsigned short> : named_arg, with_default<unsigned short>, value_arg<unsigned short>
-{
-    static constexpr FmtString fmt {"H"};
+    if (!result)
+    {
+        // The future was cancelled or already resolved, nobody is waiting for this error.
+        PyErr_WriteUnraisable(future);
+    }
+    Py_XDECREF(result);
+}
+
+} // namespace detail
+
+// ╔══════════════════════════════════════════════════════════════════════════╗
+// ║ Public API                                                               ║
+// ╚══════════════════════════════════════════════════════════════════════════╝
+
+// c-string alias for readability
+using c_str_t = const char*;
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Constexpr string utils                                                   │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+// Compile time string
+template <std::size_t N>
+struct FmtString
+{
+    constexpr FmtString(const char (&str)[N])
+    {
+        std::copy(std::begin(str), std::end(str), std::begin(value));
+    }
+
+    constexpr FmtString() = default;
+
+    char value[N] {};
+    static constexpr std::size_t size = N;
+};
+
+// Deduction guide to help the compiler
+template <std::size_t N>
+FmtString(const char (&)[N]) -> FmtString<N>;
+
+// Total size
+template <typename... Fmts>
+inline constexpr std::size_t fmt_size = (0 + ... + (Fmts::size - 1)) + 1;
+
+// Variadic constexpr function to concatenate FmtStrings in one pass
+template <typename... Fmts>
+inline consteval auto fmt_concat(Fmts... fmts)
+{
+    FmtString<fmt_size<Fmts...>> result {};
+    char* current_pos = result.value;
+
+    // Use a lambda and C++17 fold expression to copy each string
+    auto copy_fmt = [&](const auto& fmt_str) {
+        for (std::size_t i = 0; i < fmt_str.size - 1; ++i)
+        { // Copy characters, excluding null terminator
+            *current_pos++ = fmt_str.value[i];
+        }
+    };
+    (copy_fmt(fmts), ...); // Apply copy_fmt to each FmtString in the pack
+    *current_pos = '\0';   // Null-terminate the final string
+    return result;
+}
+
+// Base type of arguments with name (keyword)
+struct named_arg
+{
+    const char* name {};
+    static constexpr bool named {true};
+};
+
+// Base type of arguments with default value
+template <typename T>
+struct with_default
+{
+    T default_value {};
+};
+
+// Basic argument with a single parsed value
+template <typename T>
+struct value_arg
+{
+    static constexpr std::size_t offset = 1;
+
+    using value_type = detail::type_list<T>;
+    using parse_type = detail::type_list<T>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset>(tuple) = T {};
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple, const T& default_value)
+    {
+        std::get<Offset>(tuple) = default_value;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> T
+    {
+        return std::get<Offset>(tuple);
+    }
+};
+
+// Borrowed Python object of a checked type, exposed as Ptr
+template <PyTypeObject* Type, typename Ptr, bool Exact = false>
+struct typed_object_arg : named_arg
+{
+    using converter_t = detail::converter<&detail::check_type<Type, Exact>>;
+    using value_type = detail::type_list<Ptr>;
+    using parse_type = detail::type_list<converter_t, PyObject*>;
+    using exact_arg = typed_object_arg<Type, Ptr, true>;
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static auto get(std::tuple<Args...>& tuple) -> Ptr
+    {
+        return reinterpret_cast<Ptr>(std::get<Offset + 1>(tuple));
+    }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Marker Arguments                                                         │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+// Marker of end of positional-only arguments (Not enforced)
+struct PosOnly
+{};
+
+// Marker of start of keyword-only arguments
+struct KwOnly
+{};
+
+// Marker of start of optional arguments
+struct Optional
+{};
+
+// Marker of Python boolean value
+struct Bool
+{};
+
+// Python tuple
+struct Tuple
+{};
+
+// Python Dict
+struct Dict
+{};
+
+// Python Py_ssize_t
+struct SSize
+{};
+
+// Non negative byte
+struct NNByte
+{};
+
+// 1 byte  (bytes[1]) to char
+struct Byte1
+{};
+
+// 1 char (str) to int
+struct Char1
+{};
+
+// Filesystem Path
+struct FSPath
+{
+    static constexpr auto parse_ptr_value() { return PyUnicode_FSConverter; }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Argument specializations                                                 │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+// Validated python type
+template <typename T>
+struct Arg : typed_object_arg<&T::Type, T*>
+{};
+
+// Python tuple
+template <>
+struct Arg<Tuple> : typed_object_arg<&PyTuple_Type, PyTupleObject*>
+{};
+
+// Python dict
+template <>
+struct Arg<Dict> : typed_object_arg<&PyDict_Type, PyDictObject*>
+{};
+
+// Exact type only, subclasses are rejected: Arg<Exact<Tuple>>, Arg<Exact<cxx::List>>
+template <typename T>
+struct Exact
+{};
+
+template <typename T>
+    requires requires { typename Arg<T>::exact_arg; }
+struct Arg<Exact<T>> : Arg<T>::exact_arg
+{};
+
+// Position-only marker (not supported by PyArg_ParseTupleAndKeywords so does nothing by now)
+template <>
+struct Arg<PosOnly> : detail::marker_arg
+{
+    static constexpr FmtString fmt {""};
+};
+
+// Keyword-only marker
+template <>
+struct Arg<KwOnly> : detail::marker_arg
+{
+    static constexpr FmtString fmt {"$"};
+};
+
+// Optional marker
+template <>
+struct Arg<Optional> : detail::marker_arg
+{
+    static constexpr FmtString fmt {"|"};
+};
+
+// byte argument
+template <>
+struct Arg<NNByte> : named_arg, with_default<unsigned char>, value_arg<unsigned char>
+{
+    static constexpr FmtString fmt {"b"};
+};
+
+template <>
+struct Arg<unsigned char> : named_arg, with_default<unsigned char>, value_arg<unsigned char>
+{
+    static constexpr FmtString fmt {"B"};
+};
+
+// short argument
+template <>
+struct Arg<short> : named_arg, with_default<short>, value_arg<short>
+{
+    static constexpr FmtString fmt {"h"};
+};
+
+template <>
+struct Arg<unsigned short> : named_arg, with_default<unsigned short>, value_arg<unsigned short>
+{
+    static constexpr FmtString fmt {"H"};
 };
 
 // int argument
@@ -825,589 +1753,3849 @@ struct Arg<FSPath> : named_arg
     }
 };
 
-// Encoded c-string
-template <typename Encoding>
-struct ArgEncCStr : named_arg
+namespace detail
 {
-    static_assert(detail::has_parse_ptr_value<Encoding>,
-                  "Encoding must have a static constexpr const char* parse_ptr_value() member");
 
-    static constexpr FmtString fmt {"et"};
-    static constexpr std::size_t offset = 2;
+// C++ value of a marker inside std::optional: Arg<std::optional<Bool>> gives std::optional<int>,
+// like Arg<Bool> gives int. Other types are their own value.
+template <typename T>
+struct marker_value
+{
+    using type = T;
+};
 
-    using value_type = detail::type_list<c_str_t>;
-    using parse_type = detail::type_list<Encoding, char*>;
+template <>
+struct marker_value<Bool>
+{
+    using type = int;
+};
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple)
-    {
-        std::get<Offset>(tuple) = Encoding {};
-        std::get<Offset + 1>(tuple) = nullptr;
-    }
+template <>
+struct marker_value<SSize>
+{
+    using type = Py_ssize_t;
+};
+
+template <>
+struct marker_value<NNByte>
+{
+    using type = unsigned char;
+};
+
+template <>
+struct marker_value<Byte1>
+{
+    using type = char;
+};
+
+template <>
+struct marker_value<Char1>
+{
+    using type = int;
+};
+
+template <>
+struct marker_value<Tuple>
+{
+    using type = PyTupleObject*;
+};
+
+template <>
+struct marker_value<Dict>
+{
+    using type = PyDictObject*;
+};
+
+template <typename T>
+using marker_value_t = typename marker_value<T>::type;
+
+// from_python with the rules of the marker's format unit ("p", "n", "b", "c", "C", ...)
+template <typename T>
+inline auto from_python_marker(PyObject* obj, marker_value_t<T>& out) -> bool
+{
+    if constexpr (std::is_same_v<T, Bool>)
+    {
+        int value = PyObject_IsTrue(obj);
+        out = value > 0 ? 1 : 0;
+        return value >= 0;
+    }
+    else if constexpr (std::is_same_v<T, SSize>)
+    {
+        Py_ssize_t value = PyNumber_AsSsize_t(obj, PyExc_OverflowError);
+        if (value == -1 && PyErr_Occurred())
+        {
+            return false;
+        }
+        out = value;
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, Byte1>)
+    {
+        if (PyBytes_Check(obj) && PyBytes_GET_SIZE(obj) == 1)
+        {
+            out = PyBytes_AS_STRING(obj)[0];
+            return true;
+        }
+        if (PyByteArray_Check(obj) && PyByteArray_GET_SIZE(obj) == 1)
+        {
+            out = PyByteArray_AS_STRING(obj)[0];
+            return true;
+        }
+        PyErr_Format(PyExc_TypeError,
+                     "expected a byte string of length 1, got %.200s",
+                     Py_TYPE(obj)->tp_name);
+        return false;
+    }
+    else if constexpr (std::is_same_v<T, Char1>)
+    {
+        if (PyUnicode_Check(obj) && PyUnicode_GET_LENGTH(obj) == 1)
+        {
+            out = static_cast<int>(PyUnicode_READ_CHAR(obj, 0));
+            return true;
+        }
+        PyErr_Format(PyExc_TypeError,
+                     "expected a unicode character, got %.200s",
+                     Py_TYPE(obj)->tp_name);
+        return false;
+    }
+    else if constexpr (std::is_same_v<T, Tuple> || std::is_same_v<T, Dict>)
+    {
+        constexpr PyTypeObject* type = std::is_same_v<T, Tuple> ? &PyTuple_Type : &PyDict_Type;
+        PyObject* checked = nullptr;
+        if (!check_type<type>(obj, &checked))
+        {
+            return false;
+        }
+        out = reinterpret_cast<marker_value_t<T>>(checked);
+        return true;
+    }
+    else
+    {
+        static_assert(!std::is_same_v<T, FSPath>, "FSPath has its own std::optional argument");
+        static_assert(!std::is_same_v<T, Optional> && !std::is_same_v<T, KwOnly>
+                          && !std::is_same_v<T, PosOnly>,
+                      "Argument markers cannot be optional values");
+        return from_python(obj, out);
+    }
+}
+
+// "O&" converter of std::optional<marker_value_t<T>>, None by identity before converting
+template <typename T>
+inline auto convert_optional(PyObject* obj, void* out) -> int
+{
+    auto& value = *static_cast<std::optional<marker_value_t<T>>*>(out);
+    if (obj == Py_None)
+    {
+        value.reset();
+        return 1;
+    }
+    marker_value_t<T> converted {};
+    if (!from_python_marker<T>(obj, converted))
+    {
+        return 0;
+    }
+    value = std::move(converted);
+    return 1;
+}
+
+// "O&" converter of an optional filesystem path, stores nullptr for None
+inline auto convert_optional_path(PyObject* obj, void* out) -> int
+{
+    if (obj == Py_None)
+    {
+        *static_cast<PyObject**>(out) = nullptr;
+        return 1;
+    }
+    return PyUnicode_FSConverter(obj, out);
+}
+
+} // namespace detail
+
+// T or None, None is detected by identity before converting T (std::nullopt).
+// Markers give their value type: Arg<std::optional<SSize>> gives std::optional<Py_ssize_t>.
+template <typename T>
+struct Arg<std::optional<T>> : named_arg, with_default<std::optional<detail::marker_value_t<T>>>
+{
+    using optional_t = std::optional<detail::marker_value_t<T>>;
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using converter_t = detail::converter<&detail::convert_optional<T>>;
+
+    using value_type = detail::type_list<optional_t>;
+    using parse_type = detail::type_list<converter_t, optional_t>;
 
     template <std::size_t Offset, typename... Args>
-    static constexpr auto get(std::tuple<Args...>& tuple) -> char*
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = std::nullopt;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple, const optional_t& default_value)
+    {
+        std::get<Offset + 1>(tuple) = default_value;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> optional_t
     {
         return std::get<Offset + 1>(tuple);
     }
+};
+
+// Filesystem path or None, the encoded path is borrowed like Arg<FSPath>
+template <>
+struct Arg<std::optional<FSPath>> : named_arg
+{
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using converter_t = detail::converter<&detail::convert_optional_path>;
+
+    using value_type = detail::type_list<std::optional<std::string_view>>;
+    using parse_type = detail::type_list<converter_t, PyObject*>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static auto get(std::tuple<Args...>& tuple) -> std::optional<std::string_view>
+    {
+        if (auto* obj = std::get<Offset + 1>(tuple))
+        {
+            return std::string_view {PyBytes_AS_STRING(obj),
+                                     static_cast<std::size_t>(PyBytes_GET_SIZE(obj))};
+        }
+        return std::nullopt;
+    }
 
     template <std::size_t Offset, typename... Args>
     static constexpr auto clean(std::tuple<Args...>& tuple) -> void
     {
         if (auto* obj = std::get<Offset + 1>(tuple))
         {
-            PyMem_Free(obj);
+            Py_DECREF(obj);
             std::get<Offset + 1>(tuple) = nullptr;
         }
     }
 };
 
 // ┌──────────────────────────────────────────────────────────────────────────┐
-// │ Arguments parser                                                         │
+// │ Enumerations                                                             │
 // └──────────────────────────────────────────────────────────────────────────┘
 
-/**
- * @brief Type-safe argument parser for Python C API functions.
- *
- * The Arguments struct provides a compile-time type-safe wrapper around
- * PyArg_ParseTupleAndKeywords, eliminating manual format string construction
- * and ensuring type safety between declared arguments and callback parameters.
- *
- * @tparam Args Variadic template parameters representing argument specifications.
- *              Each argument should be an Arg<T> specialization that defines
- *              the expected Python type and corresponding C++ type.
- *
- * @par Key Features:
- * - **Compile-time Format String**: Automatically generates the PyArg_ParseTupleAndKeywords
- *   format string from argument types at compile time.
- * - **Type Safety**: Validates that callback functions accept exactly the types
- *   specified in the Arguments declaration.
- * - **Named Arguments**: Supports keyword arguments with automatic keyword array generation.
- * - **Default Values**: Supports optional arguments with default values.
- * - **RAII Cleanup**: Automatically manages memory for parsed arguments requiring cleanup.
- * - **Zero Runtime Overhead**: All type checking and format string generation happens at compile
- * time.
- *
- * @par Example Usage:
- * @code
- * // Define argument specification
- * auto args_spec = Arguments{
- *     arg_int{"width", 5},
- *     arg_int{"height", 10},
- *     arg_string{"title"}
- * };
- *
- * // Use in Python method implementation
- * static PyObject* myMethod(PyObject* self, PyObject* args, PyObject* kwds) {
- *     bool success = args_spec.match(args, kwds, [](int width, int height, std::string_view title)
- * {
- *         // Implementation with type-safe parameters
- *     });
- *
- *     if (!success) {
- *         return nullptr;
- *     }
- *     Py_RETURN_NONE;
- * }
- * @endcode
- *
- * @see Arg
- * @see dispatch_overloads
- */
-template <typename... Args>
-struct Arguments
+// String (or int) to enum: Enum<Mode, "fast", "precise", "adaptive">
+// Names are listed in enumerator order and map to E{0}..E{N-1}, so the
+// enumerators must be contiguous from 0. Use EnumValues otherwise.
+template <typename E, FmtString... Names>
+struct Enum
+{};
+
+// Name of one enumerator with its value, for EnumValues
+template <FmtString Name, auto Value>
+struct EnumValue
+{};
+
+// String (or int) to enum with explicit values:
+// EnumValues<Flag, EnumValue<"read", Flag::Read>, EnumValue<"write", Flag::Write>>
+template <typename E, typename... Values>
+struct EnumValues
+{};
+
+namespace detail
 {
-    // Types of the value tuple
-    using value_types = typename detail::expand_value_types<Args...>::value_type;
 
-    // Type of the tuple to hold the values
-    using value_tuple_t = detail::type_list_tuple<value_types>;
+// Seeded FNV-1a
+constexpr auto fnv1a(std::string_view str, std::uint32_t seed) -> std::uint32_t
+{
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (char chr : str)
+    {
+        hash = (hash ^ static_cast<unsigned char>(chr)) * 16777619u;
+    }
+    return hash;
+}
 
-    // Types to pass to Wrapped_ParseTupleAndKeywords va_list
-    using parse_types = typename detail::expand_parse_types<Args...>::parse_type;
+// Perfect hash over a fixed set of names, built at compile time
+template <FmtString... Names>
+struct perfect_hash
+{
+    static constexpr std::size_t count = sizeof...(Names);
+    static constexpr std::size_t table_size = std::bit_ceil(count * 2);
+    static constexpr std::size_t mask = table_size - 1;
 
-    // Type of the tuple to hold the values
-    using parse_tuple_t = detail::type_list_tuple<parse_types>;
+    static constexpr std::array<std::string_view, count> names {
+        std::string_view {Names.value, Names.size - 1}...};
 
-    // Tuple of Arguments
-    using args_tuple_t = detail::type_list_tuple<typename detail::expand_arg_types<Args...>::type>;
+    // Find a seed without collisions in the table
+    static consteval auto find_seed() -> std::uint32_t
+    {
+        for (std::uint32_t seed = 0; seed < 100000; ++seed)
+        {
+            std::array<bool, table_size> used {};
+            bool collision = false;
+            for (auto name : names)
+            {
+                auto slot = fnv1a(name, seed) & mask;
+                collision = collision || used[slot];
+                used[slot] = true;
+            }
+            if (!collision)
+            {
+                return seed;
+            }
+        }
+        throw "No perfect hash seed found (duplicated names?)";
+    }
 
-    /**
-     * @brief Default constructor for empty Arguments.
-     *
-     * Creates an Arguments object with no arguments. This is useful for
-     * Python methods that take no parameters beyond self.
-     *
-     * @par Example:
-     * @code
-     * auto no_args = Arguments{};
-     * no_args.match(args, kwds, []() {
-     *     // No parameters
-     * });
-     * @endcode
-     */
-    constexpr Arguments() noexcept
-        : fmt {FmtString<1>("")}
-    {}
+    static constexpr std::uint32_t seed = find_seed();
 
-    /**
-     * @brief Constructs an Arguments parser from argument specifications.
-     *
-     * Accepts a variadic list of Arg<T> specializations and builds the internal
-     * structures needed for type-safe argument parsing at compile time. This includes:
-     * - Generating the PyArg_ParseTupleAndKeywords format string
-     * - Building the keyword names array for named arguments
-     * - Storing argument metadata for validation and extraction
-     *
-     * @tparam Ts Deduced types of the argument specifications (should be Arg<T> types)
-     * @param args Variadic list of argument specifications (e.g., arg_int{"name", 5})
-     *
-     * @par Example:
-     * @code
-     * auto parser = Arguments{
-     *     arg_optionals{},
-     *     arg_int{"width", 100},      // Named argument with default value
-     *     arg_int{"height", 200},     // Named argument with default value
-     *     arg_string{"title"}         // Named argument
-     * };
-     * @endcode
-     *
-     * @note This constructor is explicit to prevent accidental implicit conversions.
-     * @note All processing happens at compile time with zero runtime overhead.
-     */
-    template <typename... Ts>
-    explicit consteval Arguments(Ts&&... arguments) noexcept
-        : fmt {fmt_concat(arguments.fmt...)}
-        , keywords {detail::build_keywords(arguments...)}
-        , args {detail::build_named_args(std::forward<Ts>(arguments)...)}
+    // Slot -> name index + 1 (0 is empty)
+    static constexpr auto slots = [] {
+        std::array<std::uint16_t, table_size> table {};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            table[fnv1a(names[i], seed) & mask] = static_cast<std::uint16_t>(i + 1);
+        }
+        return table;
+    }();
 
+    // Index of key in Names, -1 if absent
+    static constexpr auto lookup(std::string_view key) -> int
     {
-        // ...
+        auto index = slots[fnv1a(key, seed) & mask];
+        return index != 0 && names[index - 1] == key ? index - 1 : -1;
     }
 
-    /**
-     * @brief Parses Python arguments and invokes callback with type-safe parameters.
-     *
-     * Attempts to parse the Python arguments and keyword arguments according to the
-     * argument specification. If parsing succeeds, extracts the values and invokes
-     * the provided callback with the extracted values as strongly-typed parameters.
-     *
-     * The method performs the following steps:
-     * 1. Validates argument types (if Check=true, true by default)
-     * 2. Parses arguments using PyArg_ParseTupleAndKeywords
-     * 3. Extracts and converts values to their C++ types
-     * 4. Invokes the callback with the extracted values
-     * 5. Automatically cleans up temporary resources (RAII)
-     *
-     * @tparam Check Enable runtime type checking for args and kwArgs (default: true).
-     *               Set to false to skip validation if you're certain inputs are valid.
-     * @tparam Callback Deduced callable type (lambda, function pointer, functor, etc.)
+    // Names joined by ", " for error messages
+    static constexpr auto choices = [] {
+        FmtString<(0 + ... + Names.size) + 2 * count> result {};
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (char chr : names[i])
+            {
+                result.value[pos++] = chr;
+            }
+            if (i + 1 < count)
+            {
+                result.value[pos++] = ',';
+                result.value[pos++] = ' ';
+            }
+        }
+        return result;
+    }();
+};
+
+} // namespace detail
+
+namespace detail
+{
+
+// E{0}..E{N-1}, the values of Enum<E, Names...>
+template <typename E, std::size_t N>
+constexpr auto index_values() -> std::array<E, N>
+{
+    std::array<E, N> values {};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        values[i] = static_cast<E>(i);
+    }
+    return values;
+}
+
+// Enum argument from an exact name or from one of the listed int values.
+// Values[i] is the enumerator of the i-th name.
+template <typename E, auto Values, FmtString... Names>
+struct enum_arg : named_arg, with_default<E>
+{
+    static_assert(std::is_enum_v<E>, "Enum<E, ...> requires an enum type");
+    static_assert(sizeof...(Names) > 0, "Enum<E, ...> requires at least one name");
+    static_assert(Values.size() == sizeof...(Names), "One value per enumerator name");
+
+    using hash = perfect_hash<Names...>;
+    using underlying_t = std::underlying_type_t<E>;
+
+    static auto convert(PyObject* obj, void* out) -> int
+    {
+        if (PyUnicode_Check(obj))
+        {
+            Py_ssize_t size = 0;
+            const char* str = PyUnicode_AsUTF8AndSize(obj, &size);
+            if (!str)
+            {
+                return 0;
+            }
+            int index = hash::lookup({str, static_cast<std::size_t>(size)});
+            if (index < 0)
+            {
+                PyErr_Format(PyExc_ValueError,
+                             "invalid value '%U', expected one of: %s",
+                             obj,
+                             hash::choices.value);
+                return 0;
+            }
+            *static_cast<E*>(out) = Values[static_cast<std::size_t>(index)];
+            return 1;
+        }
+
+        if (PyLong_Check(obj) && !PyBool_Check(obj))
+        {
+            long long value = PyLong_AsLongLong(obj);
+            if (value == -1 && PyErr_Occurred())
+            {
+                return 0;
+            }
+            // Only the values of the listed enumerators are accepted
+            for (E candidate : Values)
+            {
+                if (std::cmp_equal(static_cast<underlying_t>(candidate), value))
+                {
+                    *static_cast<E*>(out) = candidate;
+                    return 1;
+                }
+            }
+            PyErr_Format(PyExc_ValueError,
+                         "invalid value %lld, expected the value of one of: %s",
+                         value,
+                         hash::choices.value);
+            return 0;
+        }
+
+        PyErr_Format(PyExc_TypeError, "expected str or int, got %.200s", Py_TYPE(obj)->tp_name);
+        return 0;
+    }
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using value_type = type_list<E>;
+    using parse_type = type_list<converter<&convert>, E>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = E {};
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple, const E& default_value)
+    {
+        std::get<Offset + 1>(tuple) = default_value;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> E
+    {
+        return std::get<Offset + 1>(tuple);
+    }
+};
+
+} // namespace detail
+
+// Enum argument, names in enumerator order (E{0}..E{N-1})
+template <typename E, FmtString... Names>
+struct Arg<Enum<E, Names...>>
+    : detail::enum_arg<E, detail::index_values<E, sizeof...(Names)>(), Names...>
+{};
+
+// Enum argument with explicit enumerator values
+template <typename E, FmtString... Names, E... Values>
+struct Arg<EnumValues<E, EnumValue<Names, Values>...>>
+    : detail::enum_arg<E, std::array<E, sizeof...(Values)> {Values...}, Names...>
+{};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Record fields                                                            │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+// Named attributes of a record: Fields<double, "x", "y", "z"> -> std::array<double, 3>,
+// Fields<std::tuple<int, std::string>, "id", "name"> -> std::tuple<int, std::string>.
+// Works with any object; namedtuples and __slots__ classes are read without attribute lookup.
+template <typename T, FmtString... Names>
+struct Fields
+{};
+
+namespace detail
+{
+
+// Interned Python string, created on first use, nullptr with an exception set on failure
+template <FmtString Name>
+inline auto interned() -> PyObject*
+{
+    // A failed intern is not cached, the next call retries and sets the error again
+    static PyObject* str = nullptr;
+    static cache_mutex mutex;
+    std::lock_guard<cache_mutex> guard {mutex};
+    if (!str)
+    {
+        str = PyUnicode_InternFromString(Name.value);
+    }
+    return str;
+}
+
+// Type of the namedtuple field descriptors, nullptr if the C accelerator is unavailable
+inline auto tuplegetter_type() -> PyTypeObject*
+{
+    static PyObject* type = nullptr;
+    static bool resolved = false;
+    static cache_mutex mutex;
+    std::lock_guard<cache_mutex> guard {mutex};
+    if (!resolved)
+    {
+        PyObject* module = PyImport_ImportModule("_collections");
+        type = module ? PyObject_GetAttrString(module, "_tuplegetter") : nullptr;
+        Py_XDECREF(module);
+        if (type && !PyType_Check(type))
+        {
+            Py_CLEAR(type);
+        }
+        PyErr_Clear();
+        resolved = true;
+    }
+    return reinterpret_cast<PyTypeObject*>(type);
+}
+
+// Value produced by Fields<T, Names...>
+template <typename T, std::size_t N>
+struct fields_value
+{
+    using type = std::array<T, N>;
+};
+
+template <typename... Ts, std::size_t N>
+struct fields_value<std::tuple<Ts...>, N>
+{
+    static_assert(sizeof...(Ts) == N, "Fields<std::tuple<...>, ...> requires one type per name");
+    using type = std::tuple<Ts...>;
+};
+
+// How a field is read from instances of a given type
+struct field_slot
+{
+    enum kind_t : std::uint8_t
+    {
+        attribute,   // PyObject_GetAttr
+        tuple_item,  // namedtuple field
+        member_descr // __slots__ member descriptor
+    };
+
+    kind_t kind {attribute};
+    Py_ssize_t index {};
+    PyMemberDef* member {};
+};
+
+// Field slots resolved per type, an entry is valid while the type version tag is unchanged
+template <std::size_t N>
+struct field_cache
+{
+    struct entry
+    {
+        PyTypeObject* type {};
+        unsigned int version {};
+        std::array<field_slot, N> slots {};
+    };
+
+    static constexpr std::size_t size = 4;
+
+    std::array<entry, size> entries {};
+    std::size_t next {};
+    cache_mutex mutex;
+
+    // Copies the cached slots of tp into out, false on a miss
+    auto find(PyTypeObject* tp, std::array<field_slot, N>& out) -> bool
+    {
+        if (!PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        {
+            return false;
+        }
+        std::lock_guard<cache_mutex> guard {mutex};
+        for (const auto& e : entries)
+        {
+            if (e.type == tp && e.version == tp->tp_version_tag)
+            {
+                out = e.slots;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Stores the slots of tp, replacing its entry or the next one round robin
+    void store(PyTypeObject* tp, unsigned int version, const std::array<field_slot, N>& slots)
+    {
+        std::lock_guard<cache_mutex> guard {mutex};
+        entry* target = nullptr;
+        for (auto& e : entries)
+        {
+            if (e.type == tp)
+            {
+                target = &e;
+                break;
+            }
+        }
+        if (!target)
+        {
+            target = &entries[next];
+            next = (next + 1) % size;
+        }
+        target->type = tp;
+        target->version = version;
+        target->slots = slots;
+    }
+};
+
+// Find the descriptor behind name on type, falls back to a plain attribute
+inline auto resolve_field(PyTypeObject* type, PyObject* name) -> field_slot
+{
+    field_slot slot {};
+    if (type->tp_getattro != PyObject_GenericGetAttr)
+    {
+        return slot; // custom __getattribute__ / __getattr__
+    }
+    PyObject* descr = PyObject_GetAttr(reinterpret_cast<PyObject*>(type), name);
+    if (!descr)
+    {
+        PyErr_Clear();
+        return slot;
+    }
+    // Same check as member_get: a descriptor of an unrelated type is read through getattr
+    if (Py_IS_TYPE(descr, &PyMemberDescr_Type)
+        && PyType_IsSubtype(type, reinterpret_cast<PyMemberDescrObject*>(descr)->d_common.d_type))
+    {
+        slot.kind = field_slot::member_descr;
+        slot.member = reinterpret_cast<PyMemberDescrObject*>(descr)->d_member;
+    }
+    else if (PyType_IsSubtype(type, &PyTuple_Type) && Py_TYPE(descr) == tuplegetter_type())
+    {
+        PyObject* fields = PyObject_GetAttrString(reinterpret_cast<PyObject*>(type), "_fields");
+        if (fields && PyTuple_Check(fields))
+        {
+            for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(fields); i++)
+            {
+                if (PyUnicode_Check(PyTuple_GET_ITEM(fields, i))
+                    && PyUnicode_Compare(PyTuple_GET_ITEM(fields, i), name) == 0)
+                {
+                    slot.kind = field_slot::tuple_item;
+                    slot.index = i;
+                    break;
+                }
+            }
+        }
+        Py_XDECREF(fields);
+        PyErr_Clear();
+    }
+    Py_DECREF(descr);
+    return slot;
+}
+
+// New reference to the field value, nullptr with an exception set on failure
+inline auto read_field(PyObject* obj, const field_slot& slot, PyObject* name) -> PyObject*
+{
+    switch (slot.kind)
+    {
+        case field_slot::tuple_item:
+            if (slot.index < PyTuple_GET_SIZE(obj))
+            {
+                return Py_NewRef(PyTuple_GET_ITEM(obj, slot.index));
+            }
+            break;
+        case field_slot::member_descr:
+            return PyMember_GetOne(reinterpret_cast<const char*>(obj), slot.member);
+        case field_slot::attribute:
+            break;
+    }
+    return PyObject_GetAttr(obj, name);
+}
+
+} // namespace detail
+
+// Record argument read field by field into a std::array or std::tuple
+template <typename T, FmtString... Names>
+struct Arg<Fields<T, Names...>> : named_arg
+{
+    static constexpr std::size_t count = sizeof...(Names);
+    static_assert(count > 0, "Fields<T, ...> requires at least one name");
+
+    using fields_t = typename detail::fields_value<T, count>::type;
+
+    template <std::size_t... I>
+    static auto read_all(PyObject* obj,
+                         const std::array<detail::field_slot, count>& slots,
+                         const std::array<PyObject*, count>& names,
+                         fields_t& out,
+                         std::index_sequence<I...>) -> bool
+    {
+        auto read = [&](auto& value, std::size_t index) {
+            using value_t = std::decay_t<decltype(value)>;
+            static_assert(!std::is_same_v<value_t, std::string_view>
+                              && !std::is_same_v<value_t, const char*>,
+                          "Field values may be temporary, use std::string");
+
+            PyObject* item = detail::read_field(obj, slots[index], names[index]);
+            if (!item)
+            {
+                return false;
+            }
+            bool ok = detail::from_python(item, value);
+            Py_DECREF(item);
+            return ok;
+        };
+        return (read(std::get<I>(out), I) && ...);
+    }
+
+    static auto convert(PyObject* obj, void* out) -> int
+    {
+        // Call sites usually see one or two record types
+        static detail::field_cache<count> cache;
+
+        const std::array<PyObject*, count> names {detail::interned<Names>()...};
+        for (PyObject* name : names)
+        {
+            if (!name)
+            {
+                return 0;
+            }
+        }
+
+        PyTypeObject* type = Py_TYPE(obj);
+        std::array<detail::field_slot, count> slots;
+        if (!cache.find(type, slots))
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                slots[i] = detail::resolve_field(type, names[i]);
+            }
+            // Resolving looked the names up on the type, which assigns its version tag
+            if (PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
+            {
+                cache.store(type, type->tp_version_tag, slots);
+            }
+        }
+
+        fields_t result {};
+        if (!read_all(obj, slots, names, result, std::make_index_sequence<count> {}))
+        {
+            return 0;
+        }
+        *static_cast<fields_t*>(out) = std::move(result);
+        return 1;
+    }
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using value_type = detail::type_list<fields_t>;
+    using parse_type = detail::type_list<detail::converter<&convert>, fields_t>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = fields_t {};
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> fields_t
+    {
+        return std::get<Offset + 1>(tuple);
+    }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Dictionaries                                                             │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+// dict to C++ container: Map<std::string, double> -> std::vector<std::pair<...>> sorted by
+// key, Map<K, V, std::map<K, V>> or any container with emplace() for other layouts.
+template <typename K, typename V, typename Container = std::vector<std::pair<K, V>>>
+struct Map
+{};
+
+// dict key bound to an aggregate member: Key<"width", &Options::width>
+template <FmtString Name, auto Member>
+struct Key
+{};
+
+// dict to aggregate: Record<Options, Key<"width", &Options::width>, ...>
+// Missing keys keep the member initializers of S, unknown keys are rejected.
+template <typename S, typename... Keys>
+struct Record
+{};
+
+namespace detail
+{
+
+// Class and value types of a data member pointer
+template <typename M>
+struct member_traits;
+
+template <typename T, typename C>
+struct member_traits<T C::*>
+{
+    using class_type = C;
+    using value_type = T;
+};
+
+// Convert a dict item, K/V string_views borrow from the dict
+template <typename T>
+inline auto dict_item(PyObject* obj, T& out) -> bool
+{
+    static_assert(!std::is_same_v<T, const char*>, "Use std::string or std::string_view");
+    return from_python(obj, out);
+}
+
+} // namespace detail
+
+// Map argument, converted in one PyDict_Next pass over borrowed items
+template <typename K, typename V, typename Container>
+struct Arg<Map<K, V, Container>> : named_arg
+{
+    static auto convert(PyObject* obj, void* out) -> int
+    {
+        if (!PyDict_Check(obj))
+        {
+            PyErr_Format(PyExc_TypeError, "expected dict, got %.200s", Py_TYPE(obj)->tp_name);
+            return 0;
+        }
+
+        Container result;
+        if constexpr (detail::is_vector_v<Container>)
+        {
+            result.reserve(static_cast<std::size_t>(PyDict_GET_SIZE(obj)));
+        }
+
+        Py_ssize_t pos = 0;
+        PyObject* py_key = nullptr;
+        PyObject* py_value = nullptr;
+        while (PyDict_Next(obj, &pos, &py_key, &py_value))
+        {
+            K key {};
+            V value {};
+            if (!detail::dict_item(py_key, key) || !detail::dict_item(py_value, value))
+            {
+                return 0;
+            }
+            if constexpr (detail::is_vector_v<Container>)
+            {
+                result.emplace_back(std::move(key), std::move(value));
+            }
+            else
+            {
+                result.emplace(std::move(key), std::move(value));
+            }
+        }
+
+        if constexpr (detail::is_vector_v<Container>)
+        {
+            std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+        }
+
+        *static_cast<Container*>(out) = std::move(result);
+        return 1;
+    }
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using value_type = detail::type_list<Container>;
+    using parse_type = detail::type_list<detail::converter<&convert>, Container>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = Container {};
+    }
+
+    // One-shot: moves out of the parse storage, which apply_gets reads once per parse
+    // and discards afterwards (unlike the other gets, this avoids copying the container)
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> Container
+    {
+        return std::move(std::get<Offset + 1>(tuple));
+    }
+};
+
+// Record argument, known keys looked up with interned strings
+template <typename S, FmtString... Names, auto... Members>
+struct Arg<Record<S, Key<Names, Members>...>> : named_arg
+{
+    static_assert(std::is_default_constructible_v<S>,
+                  "Record<S, ...> requires a default constructible S");
+    static_assert(
+        (std::is_same_v<typename detail::member_traits<decltype(Members)>::class_type, S> && ...),
+        "Record<S, Key<...>...> members must belong to S");
+
+    static constexpr std::size_t count = sizeof...(Names);
+
+    // Reject the first key that is not a string among Names
+    static auto unknown_key(PyObject* obj) -> int
+    {
+        Py_ssize_t pos = 0;
+        PyObject* key = nullptr;
+        PyObject* value = nullptr;
+        while (PyDict_Next(obj, &pos, &key, &value))
+        {
+            bool known = PyUnicode_Check(key)
+                         && ((PyUnicode_CompareWithASCIIString(key, Names.value) == 0) || ...);
+            if (!known)
+            {
+                PyErr_Format(PyExc_TypeError, "unexpected key %R", key);
+                return 0;
+            }
+        }
+        PyErr_BadInternalCall();
+        return 0;
+    }
+
+    static auto convert(PyObject* obj, void* out) -> int
+    {
+        if (!PyDict_Check(obj))
+        {
+            PyErr_Format(PyExc_TypeError, "expected dict, got %.200s", Py_TYPE(obj)->tp_name);
+            return 0;
+        }
+
+        S result {};
+        Py_ssize_t found = 0;
+        auto read = [&]<FmtString Name, auto Member>() {
+            PyObject* name = detail::interned<Name>();
+            if (!name)
+            {
+                return false;
+            }
+            PyObject* value = PyDict_GetItemWithError(obj, name);
+            if (!value)
+            {
+                return !PyErr_Occurred();
+            }
+            found++;
+            return detail::dict_item(value, result.*Member);
+        };
+        if (!(read.template operator()<Names, Members>() && ...))
+        {
+            return 0;
+        }
+        if (found != PyDict_GET_SIZE(obj))
+        {
+            return unknown_key(obj);
+        }
+
+        *static_cast<S*>(out) = std::move(result);
+        return 1;
+    }
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using value_type = detail::type_list<S>;
+    using parse_type = detail::type_list<detail::converter<&convert>, S>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = S {};
+    }
+
+    // One-shot: moves out of the parse storage, which apply_gets reads once per parse
+    // and discards afterwards (unlike the other gets, this avoids copying the record)
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> S
+    {
+        return std::move(std::get<Offset + 1>(tuple));
+    }
+};
+
+// Encoded c-string
+template <typename Encoding>
+struct ArgEncCStr : named_arg
+{
+    static_assert(detail::has_parse_ptr_value<Encoding>,
+                  "Encoding must have a static constexpr const char* parse_ptr_value() member");
+
+    static constexpr FmtString fmt {"et"};
+    static constexpr std::size_t offset = 2;
+
+    using value_type = detail::type_list<c_str_t>;
+    using parse_type = detail::type_list<Encoding, char*>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset>(tuple) = Encoding {};
+        std::get<Offset + 1>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> char*
+    {
+        return std::get<Offset + 1>(tuple);
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto clean(std::tuple<Args...>& tuple) -> void
+    {
+        if (auto* obj = std::get<Offset + 1>(tuple))
+        {
+            PyMem_Free(obj);
+            std::get<Offset + 1>(tuple) = nullptr;
+        }
+    }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Variadic arguments                                                       │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+/**
+ * @brief Remaining positional arguments (*args) converted to T.
+ *
+ * Up to N items are stored inline, more items spill to the heap.
+ * Views (std::string_view, const char*) borrow from the call arguments.
+ */
+template <typename T, std::size_t N = 8>
+struct VarArgs
+{
+    auto size() const -> std::size_t { return count; }
+    auto empty() const -> bool { return count == 0; }
+    auto data() const -> const T* { return heap.empty() ? local.data() : heap.data(); }
+    auto begin() const -> const T* { return data(); }
+    auto end() const -> const T* { return data() + count; }
+    auto operator[](std::size_t index) const -> const T& { return data()[index]; }
+    operator std::span<const T>() const { return {data(), count}; }
+
+    // Convert items, returns false with a Python exception set on failure
+    auto assign(PyObject* const* items, std::size_t size) -> bool
+    {
+        T* out = local.data();
+        if (size > N)
+        {
+            heap.resize(size);
+            out = heap.data();
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (!detail::from_python(items[i], out[i]))
+            {
+                return false;
+            }
+        }
+        count = size;
+        return true;
+    }
+
+private:
+    std::array<T, N> local {};
+    std::vector<T> heap;
+    std::size_t count {};
+};
+
+// Remaining positional arguments as a borrowed span over the arguments tuple (no copies)
+template <std::size_t N>
+struct VarArgs<PyObject*, N>
+{
+    std::span<PyObject* const> items;
+
+    auto size() const -> std::size_t { return items.size(); }
+    auto empty() const -> bool { return items.empty(); }
+    auto data() const -> PyObject* const* { return items.data(); }
+    auto begin() const { return items.begin(); }
+    auto end() const { return items.end(); }
+    auto operator[](std::size_t index) const -> PyObject* { return items[index]; }
+    operator std::span<PyObject* const>() const { return items; }
+
+    auto assign(PyObject* const* data, std::size_t size) -> bool
+    {
+        items = {data, size};
+        return true;
+    }
+};
+
+// *args capture: positional arguments left after the declared ones.
+// Must be declared before the keyword-only marker.
+template <typename T, std::size_t N>
+struct Arg<VarArgs<T, N>> : detail::capture_arg
+{
+    static constexpr FmtString fmt {""};
+    static constexpr bool var_args {true};
+
+    using value_type = detail::type_list<VarArgs<T, N>>;
+
+    static auto capture(const detail::call_context& ctx, VarArgs<T, N>& out) -> bool
+    {
+        if (ctx.nargs <= ctx.consumed)
+        {
+            return true;
+        }
+        return out.assign(ctx.args + ctx.consumed,
+                          static_cast<std::size_t>(ctx.nargs - ctx.consumed));
+    }
+};
+
+/**
+ * @brief Keyword arguments left after the declared ones are matched (**kwargs).
+ *
+ * Borrowed view over the keyword arguments as received, the dict of a tp_call or the
+ * kwnames and values of a vectorcall: no filtered copy is made, declared keywords are
+ * skipped while iterating. Items are (key, value) pairs of borrowed references, valid
+ * for the scope of the callback.
+ */
+struct VarKw
+{
+    using item_type = std::pair<PyObject*, PyObject*>;
+
+    struct iterator
+    {
+        const VarKw* owner {};
+        Py_ssize_t pos {};
+        item_type item {};
+
+        auto operator*() const -> const item_type& { return item; }
+        auto operator->() const -> const item_type* { return &item; }
+
+        auto operator++() -> iterator&
+        {
+            while (owner->kwargs.next(pos, item.first, item.second))
+            {
+                if (!owner->keywords.contains(item.first))
+                {
+                    return *this;
+                }
+            }
+            owner = nullptr;
+            return *this;
+        }
+
+        auto operator==(const iterator& other) const -> bool
+        {
+            return owner == other.owner && (owner == nullptr || pos == other.pos);
+        }
+    };
+
+    detail::keyword_args kwargs {};
+    detail::keyword_names keywords {};
+    std::size_t count {};
+
+    auto size() const -> std::size_t { return count; }
+    auto empty() const -> bool { return count == 0; }
+    auto begin() const -> iterator { return count ? ++iterator {this} : end(); }
+    auto end() const -> iterator { return {}; }
+
+    // Borrowed value of an extra keyword, nullptr if absent (no exception set)
+    auto get(const char* key) const -> PyObject*
+    {
+        for (const auto& [name, value] : *this)
+        {
+            if (PyUnicode_Check(name) && PyUnicode_CompareWithASCIIString(name, key) == 0)
+            {
+                return value;
+            }
+        }
+        return nullptr;
+    }
+
+    // New dict with the extra keywords (new reference), for APIs that need a real dict
+    auto to_dict() const -> PyObject*
+    {
+        PyObject* dict = PyDict_New();
+        for (auto it = begin(); dict && it != end(); ++it)
+        {
+            if (PyDict_SetItem(dict, it->first, it->second) < 0)
+            {
+                Py_CLEAR(dict);
+            }
+        }
+        return dict;
+    }
+};
+
+// **kwargs capture: keyword arguments not matching any declared keyword
+template <>
+struct Arg<VarKw> : detail::capture_arg
+{
+    static constexpr FmtString fmt {""};
+
+    using value_type = detail::type_list<VarKw>;
+
+    static auto capture(const detail::call_context& ctx, VarKw& out) -> bool
+    {
+        out = VarKw {ctx.kwargs, ctx.keywords, static_cast<std::size_t>(ctx.extra_keywords)};
+        return true;
+    }
+};
+
+// Iterating the view reads the keyword arguments
+template <>
+inline constexpr bool detail::gil_bound_v<VarKw> = true;
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Python callables                                                         │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+// Thrown by C++ code running inside a callback when a Python exception is already set.
+// Arguments::match catches it and returns false, leaving the exception in place.
+struct PythonError : std::exception
+{
+    auto what() const noexcept -> const char* override { return "Python exception set"; }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Lazy arguments                                                           │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+/**
+ * @brief Argument converted to T on first use.
+ *
+ * Parsing only runs a cheap type check (see detail::lazy_check). The conversion
+ * happens the first time the callback reads the value, and the result is kept for
+ * the rest of the call. Arguments the callback never reads are never converted.
+ *
+ * @code
+ * Arguments {arg_string {"mode"}, Arg<Lazy<std::vector<double>>> {"weights"}}
+ *     .match(args, kwds, [](std::string mode, Lazy<std::vector<double>> weights) {
+ *         if (mode == "weighted")
+ *             use(*weights);   // converted here, PythonError on failure
+ *     });
+ * @endcode
+ *
+ * @note The Python object is borrowed: Lazy is valid for the scope of the callback.
+ *       Not allowed in match_async callbacks, which run without the GIL.
+ */
+template <typename T>
+class Lazy
+{
+public:
+    Lazy() = default;
+
+    explicit Lazy(PyObject* obj)
+        : obj {obj}
+    {}
+
+    // Whether the argument was given (false for missing optional arguments)
+    auto has_value() const -> bool { return obj != nullptr; }
+
+    explicit operator bool() const { return has_value(); }
+
+    // Borrowed Python object
+    auto object() const -> PyObject* { return obj; }
+
+    // Converted value, throws PythonError if missing or not convertible
+    auto value() const -> const T&
+    {
+        if (!cached)
+        {
+            if (!obj)
+            {
+                PyErr_SetString(PyExc_TypeError, "lazy argument was not given");
+                throw PythonError {};
+            }
+            T converted {};
+            if (!detail::from_python(obj, converted))
+            {
+                throw PythonError {};
+            }
+            cached.emplace(std::move(converted));
+        }
+        return *cached;
+    }
+
+    auto value_or(T fallback) const -> T { return obj ? value() : std::move(fallback); }
+
+    auto operator*() const -> const T& { return value(); }
+    auto operator->() const -> const T* { return &value(); }
+
+private:
+    PyObject* obj {};
+    mutable std::optional<T> cached;
+};
+
+// Converted on first read, which needs the GIL
+template <typename T>
+inline constexpr bool detail::gil_bound_v<Lazy<T>> = true;
+
+namespace detail
+{
+
+// Cheap check of the Python type a lazy T is converted from, conversion errors
+// are still possible (overflow, items of a sequence, ...)
+template <typename T>
+inline auto lazy_check(PyObject* obj) -> bool
+{
+    const char* expected = nullptr;
+    if constexpr (std::is_same_v<T, bool> || std::is_base_of_v<::Py::Object, T>
+                  || std::is_same_v<T, PyObject*>)
+    {
+        return true;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        if (PyLong_Check(obj) || PyIndex_Check(obj))
+        {
+            return true;
+        }
+        expected = "int";
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        if (PyFloat_Check(obj) || PyNumber_Check(obj))
+        {
+            return true;
+        }
+        expected = "float";
+    }
+    else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+                       || std::is_same_v<T, const char*>)
+    {
+        if (PyUnicode_Check(obj))
+        {
+            return true;
+        }
+        expected = "str";
+    }
+    else if constexpr (is_optional_v<T>)
+    {
+        return obj == Py_None || lazy_check<typename T::value_type>(obj);
+    }
+    else if constexpr (is_vector_v<T>)
+    {
+        if (PySequence_Check(obj) || PyIter_Check(obj))
+        {
+            return true;
+        }
+        expected = "a sequence";
+    }
+    else
+    {
+        return true;
+    }
+    PyErr_Format(PyExc_TypeError, "expected %s, got %.200s", expected, Py_TYPE(obj)->tp_name);
+    return false;
+}
+
+// "O&" converter storing the borrowed object after lazy_check
+template <typename T>
+inline auto convert_lazy(PyObject* obj, void* out) -> int
+{
+    if (!lazy_check<T>(obj))
+    {
+        return 0;
+    }
+    *static_cast<PyObject**>(out) = obj;
+    return 1;
+}
+
+} // namespace detail
+
+// Lazy<T>: type checked while parsing, converted when the callback reads it
+template <typename T>
+struct Arg<Lazy<T>> : named_arg
+{
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using converter_t = detail::converter<&detail::convert_lazy<T>>;
+
+    using value_type = detail::type_list<Lazy<T>>;
+    using parse_type = detail::type_list<converter_t, PyObject*>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static auto get(std::tuple<Args...>& tuple) -> Lazy<T>
+    {
+        return Lazy<T> {static_cast<PyObject*>(std::get<Offset + 1>(tuple))};
+    }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Output builders                                                          │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+namespace detail
+{
+
+// bytes storage, shrunk with _PyBytes_Resize
+struct bytes_storage
+{
+    static auto create(Py_ssize_t size) -> PyObject*
+    {
+        return PyBytes_FromStringAndSize(nullptr, size);
+    }
+
+    static auto data(PyObject* object) -> char* { return PyBytes_AS_STRING(object); }
+
+    static auto resize(PyObject** object, Py_ssize_t size) -> int
+    {
+        return _PyBytes_Resize(object, size);
+    }
+
+    static auto finish(PyObject** object, Py_ssize_t size) -> PyObject*
+    {
+        if (PyBytes_GET_SIZE(*object) != size && _PyBytes_Resize(object, size) < 0)
+        {
+            return nullptr;
+        }
+        return std::exchange(*object, nullptr);
+    }
+};
+
+// str storage of the 1 byte ASCII kind, filled with UTF-8. Results that turn out
+// not to be ASCII are decoded once into the proper kind.
+struct ascii_storage
+{
+    static auto create(Py_ssize_t size) -> PyObject* { return PyUnicode_New(size, 127); }
+
+    static auto data(PyObject* object) -> char*
+    {
+        return static_cast<char*>(PyUnicode_DATA(object));
+    }
+
+    static auto resize(PyObject** object, Py_ssize_t size) -> int
+    {
+        return PyUnicode_Resize(object, size);
+    }
+
+    static auto finish(PyObject** object, Py_ssize_t size) -> PyObject*
+    {
+        const char* text = data(*object);
+        bool ascii = std::all_of(text, text + size, [](char c) {
+            return static_cast<unsigned char>(c) < 0x80;
+        });
+        if (!ascii)
+        {
+            PyObject* result = PyUnicode_DecodeUTF8(text, size, nullptr);
+            Py_CLEAR(*object);
+            return result;
+        }
+        if (PyUnicode_GET_LENGTH(*object) != size && PyUnicode_Resize(object, size) < 0)
+        {
+            return nullptr;
+        }
+        return std::exchange(*object, nullptr);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Writes a bytes or str result directly into the storage of the Python object.
+ *
+ * The object is allocated up front with the size hint and grows geometrically
+ * when writes go beyond it. release() shrinks it to the written size in place and
+ * hands it over, so the payload is never copied through a std::string. Returning
+ * the builder from a callback (to_python) releases it.
+ *
+ * @code
+ * BytesBuilder out {estimated_size};
+ * out.append(header);
+ * char* row = out.grow(row_size);       // write row_size bytes in place
+ * ...
+ * return out;                           // or out.release()
+ * @endcode
+ *
+ * @note Allocation failures throw PythonError.
+ * @note Pointers from data() and grow() are invalidated by the next write.
+ */
+template <typename Storage>
+class OutputBuilder
+{
+public:
+    explicit OutputBuilder(Py_ssize_t size_hint = 0)
+        : object {Storage::create(size_hint)}
+        , capacity {size_hint}
+    {
+        if (!object)
+        {
+            throw PythonError {};
+        }
+    }
+
+    OutputBuilder(OutputBuilder&& other) noexcept
+        : object {std::exchange(other.object, nullptr)}
+        , length {std::exchange(other.length, 0)}
+        , capacity {std::exchange(other.capacity, 0)}
+    {}
+
+    auto operator=(OutputBuilder&& other) noexcept -> OutputBuilder&
+    {
+        std::swap(object, other.object);
+        std::swap(length, other.length);
+        std::swap(capacity, other.capacity);
+        return *this;
+    }
+
+    OutputBuilder(const OutputBuilder&) = delete;
+    auto operator=(const OutputBuilder&) -> OutputBuilder& = delete;
+
+    ~OutputBuilder() { Py_XDECREF(object); }
+
+    auto size() const -> Py_ssize_t { return length; }
+
+    auto data() -> char* { return Storage::data(object); }
+
+    // Storage for at least size bytes without changing size()
+    void reserve(Py_ssize_t size)
+    {
+        if (size <= capacity)
+        {
+            return;
+        }
+        Py_ssize_t grown = std::max(size, capacity * 2);
+        if (Storage::resize(&object, grown) < 0)
+        {
+            length = capacity = 0;
+            throw PythonError {};
+        }
+        capacity = grown;
+    }
+
+    // Sets the written size, new bytes are uninitialized
+    void resize(Py_ssize_t size)
+    {
+        reserve(size);
+        length = size;
+    }
+
+    // count writable bytes at the end
+    auto grow(Py_ssize_t count) -> char*
+    {
+        Py_ssize_t offset = length;
+        resize(length + count);
+        return data() + offset;
+    }
+
+    void append(std::string_view text)
+    {
+        std::copy_n(text.data(), text.size(), grow(static_cast<Py_ssize_t>(text.size())));
+    }
+
+    void push_back(char c) { *grow(1) = c; }
+
+    // New reference to the finished object (nullptr with an exception set on
+    // failure), the builder is left empty
+    auto release() -> PyObject*
+    {
+        if (!object)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "output builder already released");
+            return nullptr;
+        }
+        PyObject* result = Storage::finish(&object, length);
+        Py_CLEAR(object);
+        length = capacity = 0;
+        return result;
+    }
+
+private:
+    PyObject* object {};
+    Py_ssize_t length {};
+    Py_ssize_t capacity {};
+};
+
+// bytes result builder
+using BytesBuilder = OutputBuilder<detail::bytes_storage>;
+
+// str result builder taking UTF-8, ASCII results keep the storage they were written to
+using StringBuilder = OutputBuilder<detail::ascii_storage>;
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Lazy iterators                                                           │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+/**
+ * @brief Coroutine generator, an input range of the values it co_yields.
+ *
+ * Returned from a callback (or any typed return converted by to_python) it becomes
+ * a Python iterator: the body runs on demand, one item per __next__, and nothing is
+ * materialized.
+ *
+ * @code
+ * auto edges(const Mesh& mesh) -> Generator<std::pair<int, int>>
+ * {
+ *     for (const auto& face : mesh.faces)
+ *         co_yield {face.a, face.b};
+ * }
+ * @endcode
+ *
+ * @note Exceptions thrown by the body are rethrown from begin()/operator++.
+ */
+template <typename T>
+class Generator
+{
+public:
+    using value_type = std::remove_cvref_t<T>;
+
+    struct promise_type
+    {
+        const value_type* current {};
+        std::exception_ptr exception;
+
+        auto get_return_object() -> Generator
+        {
+            return Generator {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+        auto final_suspend() noexcept -> std::suspend_always { return {}; }
+
+        // The yielded value lives until the coroutine is resumed
+        auto yield_value(const value_type& value) noexcept -> std::suspend_always
+        {
+            current = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept {}
+        void unhandled_exception() { exception = std::current_exception(); }
+    };
+
+    struct sentinel
+    {};
+
+    class iterator
+    {
+    public:
+        using value_type = Generator::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(std::coroutine_handle<promise_type> handle)
+            : handle {handle}
+        {}
+
+        auto operator*() const -> const value_type& { return *handle.promise().current; }
+
+        auto operator++() -> iterator&
+        {
+            resume(handle);
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend auto operator==(const iterator& it, sentinel /*end*/) -> bool
+        {
+            return it.handle.done();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    explicit Generator(std::coroutine_handle<promise_type> handle)
+        : handle {handle}
+    {}
+
+    Generator(Generator&& other) noexcept
+        : handle {std::exchange(other.handle, {})}
+    {}
+
+    auto operator=(Generator&& other) noexcept -> Generator&
+    {
+        std::swap(handle, other.handle);
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    auto operator=(const Generator&) -> Generator& = delete;
+
+    ~Generator()
+    {
+        if (handle)
+        {
+            handle.destroy();
+        }
+    }
+
+    // Runs the body up to the first co_yield
+    auto begin() -> iterator
+    {
+        resume(handle);
+        return iterator {handle};
+    }
+
+    auto end() const -> sentinel { return {}; }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+    static void resume(std::coroutine_handle<promise_type> handle)
+    {
+        handle.resume();
+        if (auto exception = std::exchange(handle.promise().exception, nullptr))
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+namespace detail
+{
+
+// Python object of the lazy iterator type, the C++ range state is type erased
+struct range_iterator_object
+{
+    PyObject_HEAD
+    void* state;
+    PyObject* (*next)(void* state);
+    void (*destroy)(void* state);
+};
+
+// Owned range and its position, begin() is deferred to the first __next__
+template <typename R>
+struct range_iterator_state
+{
+    R range;
+    std::optional<std::ranges::iterator_t<R>> current;
+    bool done = false;
+
+    static auto next(void* ptr) -> PyObject*
+    {
+        auto* self = static_cast<range_iterator_state*>(ptr);
+        if (self->done)
+        {
+            return nullptr;
+        }
+        try
+        {
+            if (self->current)
+            {
+                ++*self->current;
+            }
+            else
+            {
+                self->current.emplace(std::ranges::begin(self->range));
+            }
+            if (*self->current == std::ranges::end(self->range))
+            {
+                self->done = true;
+                return nullptr;
+            }
+            return to_python(**self->current);
+        }
+        catch (const PythonError&)
+        {
+        }
+        catch (const ::Py::BaseException&)
+        {
+        }
+        catch (const std::exception& exc)
+        {
+            PyErr_SetString(PyExc_RuntimeError, exc.what());
+        }
+        catch (...)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "Unknown C++ exception in range iterator");
+        }
+        self->done = true;
+        return nullptr;
+    }
+
+    static void destroy(void* ptr) { delete static_cast<range_iterator_state*>(ptr); }
+};
+
+inline auto range_iterator_next(PyObject* self) -> PyObject*
+{
+    auto* iterator = reinterpret_cast<range_iterator_object*>(self);
+    return iterator->next(iterator->state);
+}
+
+inline void range_iterator_dealloc(PyObject* self)
+{
+    auto* iterator = reinterpret_cast<range_iterator_object*>(self);
+    PyTypeObject* type = Py_TYPE(self);
+    iterator->destroy(iterator->state);
+    PyObject_Free(self);
+    Py_DECREF(type);
+}
+
+// Shared iterator type, created on first use
+inline auto range_iterator_type() -> PyTypeObject*
+{
+    static PyTypeObject* type = [] {
+        static PyType_Slot slots[] = {
+            {Py_tp_dealloc, reinterpret_cast<void*>(&range_iterator_dealloc)},
+            {Py_tp_iter, reinterpret_cast<void*>(&PyObject_SelfIter)},
+            {Py_tp_iternext, reinterpret_cast<void*>(&range_iterator_next)},
+            {0, nullptr}};
+        static PyType_Spec spec {"pyargs.range_iterator",
+                                 sizeof(range_iterator_object),
+                                 0,
+                                 Py_TPFLAGS_DEFAULT | Py_TPFLAGS_DISALLOW_INSTANTIATION,
+                                 slots};
+        return reinterpret_cast<PyTypeObject*>(PyType_FromSpec(&spec));
+    }();
+    return type;
+}
+
+template <typename R>
+auto make_range_iterator(R&& range) -> PyObject*
+{
+    using state_t = range_iterator_state<std::remove_cvref_t<R>>;
+
+    PyTypeObject* type = range_iterator_type();
+    if (!type)
+    {
+        return nullptr;
+    }
+    auto* iterator = PyObject_New(range_iterator_object, type);
+    if (!iterator)
+    {
+        return nullptr;
+    }
+    iterator->state = new state_t {std::forward<R>(range), std::nullopt};
+    iterator->next = &state_t::next;
+    iterator->destroy = &state_t::destroy;
+    return reinterpret_cast<PyObject*>(iterator);
+}
+
+} // namespace detail
+
+// Typed Python callable: PyFunction<double(double, int)>
+template <typename Signature>
+struct PyFunction;
+
+/**
+ * @brief Typed view of a Python callable.
+ *
+ * Calls go through PyObject_Vectorcall with the converted arguments on a stack array,
+ * and the result is converted back to R with the same converters used by the parser.
+ * On Python errors PythonError is thrown, so calls can be made directly from a match
+ * callback.
+ *
+ * The callable is borrowed: it is valid for the scope of the callback only.
+ * PyObject* arguments are borrowed, a PyObject* result is a new reference.
+ */
+template <typename R, typename... A>
+struct PyFunction<R(A...)>
+{
+    static_assert(!std::is_same_v<R, std::string_view> && !std::is_same_v<R, const char*>,
+                  "Views into the result object would dangle, use std::string instead");
+
+    PyObject* func {};
+
+    auto operator()(A... params) const -> R
+    {
+        // Slot 0 is scratch space for the callee (PY_VECTORCALL_ARGUMENTS_OFFSET)
+        PyObject* stack[sizeof...(A) + 1] {};
+        PyObject** argv = stack + 1;
+
+        // Convert in order and stop at the first failure, keeping its exception
+        std::size_t count = 0;
+        bool ok = (true && ... && ((argv[count] = to_arg(std::forward<A>(params))) && ++count));
+
+        PyObject* result = ok ? PyObject_Vectorcall(
+                                    func, argv, sizeof...(A) | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr)
+                              : nullptr;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Py_DECREF(argv[i]);
+        }
+
+        if (!result)
+        {
+            throw PythonError {};
+        }
+
+        if constexpr (std::is_void_v<R>)
+        {
+            Py_DECREF(result);
+        }
+        else if constexpr (std::is_same_v<R, PyObject*>)
+        {
+            return result;
+        }
+        else
+        {
+            R value {};
+            bool converted = detail::from_python(result, value);
+            Py_DECREF(result);
+            if (!converted)
+            {
+                throw PythonError {};
+            }
+            return value;
+        }
+    }
+
+private:
+    template <typename T>
+    static auto to_arg(T&& value) -> PyObject*
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<T>, PyObject*>)
+        {
+            return Py_NewRef(value);
+        }
+        else
+        {
+            return detail::to_python(std::forward<T>(value));
+        }
+    }
+};
+
+// Calls into Python
+template <typename R, typename... A>
+inline constexpr bool detail::gil_bound_v<PyFunction<R(A...)>> = true;
+
+// Typed python callable, callability is checked once while parsing
+template <typename R, typename... A>
+struct Arg<PyFunction<R(A...)>> : named_arg
+{
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    using value_type = detail::type_list<PyFunction<R(A...)>>;
+    using parse_type = detail::type_list<detail::converter<&detail::convert_callable>, PyObject*>;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr auto get(std::tuple<Args...>& tuple) -> PyFunction<R(A...)>
+    {
+        return {std::get<Offset + 1>(tuple)};
+    }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Arguments parser                                                         │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+/**
+ * @brief Type-safe argument parser for Python C API functions.
+ *
+ * The Arguments struct provides a compile-time type-safe wrapper around
+ * PyArg_ParseTupleAndKeywords, eliminating manual format string construction
+ * and ensuring type safety between declared arguments and callback parameters.
+ *
+ * @tparam Args Variadic template parameters representing argument specifications.
+ *              Each argument should be an Arg<T> specialization that defines
+ *              the expected Python type and corresponding C++ type.
+ *
+ * @par Key Features:
+ * - **Compile-time Format String**: Automatically generates the PyArg_ParseTupleAndKeywords
+ *   format string from argument types at compile time.
+ * - **Type Safety**: Validates that callback functions accept exactly the types
+ *   specified in the Arguments declaration.
+ * - **Named Arguments**: Supports keyword arguments with automatic keyword array generation.
+ * - **Default Values**: Supports optional arguments with default values.
+ * - **RAII Cleanup**: Automatically manages memory for parsed arguments requiring cleanup.
+ * - **Zero Runtime Overhead**: All type checking and format string generation happens at compile
+ * time.
+ *
+ * @par Example Usage:
+ * @code
+ * // Define argument specification
+ * auto args_spec = Arguments{
+ *     arg_int{"width", 5},
+ *     arg_int{"height", 10},
+ *     arg_string{"title"}
+ * };
+ *
+ * // Use in Python method implementation
+ * static PyObject* myMethod(PyObject* self, PyObject* args, PyObject* kwds) {
+ *     bool success = args_spec.match(args, kwds, [](int width, int height, std::string_view title)
+ * {
+ *         // Implementation with type-safe parameters
+ *     });
+ *
+ *     if (!success) {
+ *         return nullptr;
+ *     }
+ *     Py_RETURN_NONE;
+ * }
+ * @endcode
+ *
+ * @see Arg
+ * @see dispatch_overloads
+ */
+template <typename... Args>
+struct Arguments
+{
+    // Types of the value tuple
+    using value_types = typename detail::expand_value_types<Args...>::value_type;
+
+    // Type of the tuple to hold the values
+    using value_tuple_t = detail::type_list_tuple<value_types>;
+
+    // Types to pass to Wrapped_ParseTupleAndKeywords va_list
+    using parse_types = typename detail::expand_parse_types<Args...>::parse_type;
+
+    // Type of the tuple to hold the values
+    using parse_tuple_t = detail::type_list_tuple<parse_types>;
+
+    // Tuple of Arguments
+    using args_tuple_t = detail::type_list_tuple<typename detail::expand_arg_types<Args...>::type>;
+
+    // Number of named arguments
+    static constexpr std::size_t keyword_count = detail::count_keywords<Args...>;
+
+    // Interned keyword names, in keywords order
+    using keyword_names_t = std::array<PyObject*, keyword_count>;
+
+    // Number of named arguments that can be passed by position (before the KwOnly marker)
+    static constexpr Py_ssize_t positional_count = [] {
+        Py_ssize_t count = 0;
+        bool kw_only = false;
+        ((kw_only = kw_only || std::is_same_v<Args, Arg<KwOnly>>,
+          count += (!kw_only && Args::named) ? 1 : 0),
+         ...);
+        return count;
+    }();
+
+    // Whether any argument takes its value from the call context
+    static constexpr bool has_captures = (false || ... || detail::is_capture_arg<Args>);
+
+    // Whether extra positional arguments are accepted (*args)
+    static constexpr bool has_var_args = (false || ... || detail::is_var_args_arg<Args>);
+
+    // Whether undeclared keyword arguments are accepted (**kwargs)
+    static constexpr bool has_var_kw = (false || ... || std::is_same_v<Args, Arg<VarKw>>);
+
+    // Whether a call without keywords can be parsed from a vectorcall array: every
+    // argument is a plain positional format unit (no captures, no keyword-only marker)
+    static constexpr bool stack_parsable = !has_captures
+        && !(false || ... || std::is_same_v<Args, Arg<KwOnly>>);
+
+    /**
+     * @brief Default constructor for empty Arguments.
+     *
+     * Creates an Arguments object with no arguments. This is useful for
+     * Python methods that take no parameters beyond self.
+     *
+     * @par Example:
+     * @code
+     * auto no_args = Arguments{};
+     * no_args.match(args, kwds, []() {
+     *     // No parameters
+     * });
+     * @endcode
+     */
+    constexpr Arguments() noexcept
+        : fmt {FmtString<1>("")}
+    {}
+
+    /**
+     * @brief Constructs an Arguments parser from argument specifications.
+     *
+     * Accepts a variadic list of Arg<T> specializations and builds the internal
+     * structures needed for type-safe argument parsing at compile time. This includes:
+     * - Generating the PyArg_ParseTupleAndKeywords format string
+     * - Building the keyword names array for named arguments
+     * - Storing argument metadata for validation and extraction
+     *
+     * @tparam Ts Deduced types of the argument specifications (should be Arg<T> types)
+     * @param args Variadic list of argument specifications (e.g., arg_int{"name", 5})
+     *
+     * @par Example:
+     * @code
+     * auto parser = Arguments{
+     *     arg_optionals{},
+     *     arg_int{"width", 100},      // Named argument with default value
+     *     arg_int{"height", 200},     // Named argument with default value
+     *     arg_string{"title"}         // Named argument
+     * };
+     * @endcode
+     *
+     * @note This constructor is explicit to prevent accidental implicit conversions.
+     * @note All processing happens at compile time with zero runtime overhead.
+     */
+    template <typename... Ts>
+    explicit consteval Arguments(Ts&&... arguments) noexcept
+        : fmt {fmt_concat(arguments.fmt...)}
+        , keywords {detail::build_keywords(arguments...)}
+        , args {detail::build_named_args(std::forward<Ts>(arguments)...)}
+
+    {
+        // ...
+    }
+
+    /**
+     * @brief Parses Python arguments and invokes callback with type-safe parameters.
+     *
+     * Attempts to parse the Python arguments and keyword arguments according to the
+     * argument specification. If parsing succeeds, extracts the values and invokes
+     * the provided callback with the extracted values as strongly-typed parameters.
+     *
+     * The method performs the following steps:
+     * 1. Validates argument types (if Check=true, true by default)
+     * 2. Parses arguments using PyArg_ParseTupleAndKeywords
+     * 3. Extracts and converts values to their C++ types
+     * 4. Invokes the callback with the extracted values
+     * 5. Automatically cleans up temporary resources (RAII)
+     *
+     * @tparam Check Enable runtime type checking for args and kwArgs (default: true).
+     *               Set to false to skip validation if you're certain inputs are valid.
+     * @tparam Callback Deduced callable type (lambda, function pointer, functor, etc.)
+     *
+     * @param args Python tuple containing positional arguments (from PyObject* args parameter)
+     * @param kwArgs Python dict containing keyword arguments (from PyObject* kwds parameter)
+     * @param callback Callable object that accepts the parsed arguments as parameters.
+     *                 Must accept exactly the types specified in the Arguments definition.
+     *
+     * @return true if parsing succeeded and callback was invoked, false otherwise.
+     *         On failure, a Python exception is set (accessible via PyErr_Occurred).
+     *
+     * @par Example:
+     * @code
+     * auto args_spec = Arguments{
+     *     arg_int{"width"},
+     *     arg_int{"height"},
+     *     arg_string{"title"}
+     * };
+     *
+     * static PyObject* myMethod(PyObject* self, PyObject* args, PyObject* kwds) {
+     *     bool success = args_spec.match(args, kwds, [](int w, int h, std::string_view title) {
+     *         // Type-safe implementation - compiler ensures types match
+     *         std::cout << "Creating " << w << "x" << h << " window: " << title << "\n";
+     *     });
+     *
+     *     if (!success) {
+     *         return nullptr;  // Python exception already set
+     *     }
+     *     Py_RETURN_NONE;
+     * }
+     * @endcode
+     *
+     * @note The callback signature is validated at compile time. Compilation will fail
+     *       if the callback parameters don't match the argument specification.
+     * @note Memory management is automatic - temporary resources are cleaned up even
+     *       if the callback throws an exception.
+     * @note If parsing fails, a Python exception is set internally and must be handled
+     *       by the caller (typically by returning nullptr to Python).
+     * @note A PythonError thrown by the callback is caught and reported as false, with the
+     *       Python exception left in place.
+     *
+     * @warning The callback should not store references to string_view or pointer parameters
+     *          beyond its scope, as they may reference temporary storage.
+     */
+    template <bool Check = false, typename Callback>
+    auto match(PyObject* args, PyObject* kwArgs, Callback&& callback) const -> bool
+    {
+        using namespace detail;
+
+        static_assert(is_callable_with_tuple_v<Callback, value_tuple_t>,
+                      "Lambda must be callable with the expected argument "
+                      "types from Arguments definition.");
+
+        if constexpr (Check)
+        {
+            if ((args == nullptr || !PyTuple_Check(args))
+                || (kwArgs != nullptr && !PyDict_Check(kwArgs)))
+            {
+                PyErr_BadInternalCall();
+                return false;
+            }
+        }
+
+        auto parse_fn = [&](parse_tuple_t& parsed, value_tuple_t& values) {
+            return parse(args, kwArgs, parsed, values);
+        };
+        return run(parse_fn, std::forward<Callback>(callback)) == match_status::done;
+    }
+
+    /**
+     * @brief Same as match() for vectorcall/METH_FASTCALL arguments.
+     *
+     * Signatures with captures are parsed item by item from the args array and kwnames
+     * (see parse_items): VarArgs and VarKw view them in place. Calls without keywords are
+     * parsed straight from the args array when the signature allows it (see
+     * stack_parsable) and the Python headers declare _PyArg_ParseStack (before 3.13).
+     * Otherwise the positionals are packed into one tuple and a keywords dict is made
+     * only when kwnames is not empty, then parsing proceeds as in match(). Used by
+     * tp_vectorcall constructors (see vectorcall_init) and fastcall methods.
+     */
+    template <typename Callback>
+    auto match_vectorcall(PyObject* const* args,
+                          std::size_t nargsf,
+                          PyObject* kwnames,
+                          Callback&& callback) const -> bool
+    {
+        using namespace detail;
+
+        static_assert(is_callable_with_tuple_v<Callback, value_tuple_t>,
+                      "Lambda must be callable with the expected argument "
+                      "types from Arguments definition.");
+
+        Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+
+        if constexpr (has_captures)
+        {
+            // Parsed item by item, captures view the array and kwnames in place
+            auto parse_fn = [&](parse_tuple_t& parsed, value_tuple_t& values) {
+                return parse_items(
+                    args, nargs, keyword_args {nullptr, kwnames, args + nargs}, parsed, values);
+            };
+            return run(parse_fn, std::forward<Callback>(callback)) == match_status::done;
+        }
+
+#if !defined(Py_LIMITED_API) && PY_VERSION_HEX < 0x030D0000
+        if constexpr (stack_parsable)
+        {
+            if (kwnames == nullptr || PyTuple_GET_SIZE(kwnames) == 0)
+            {
+                auto parse_fn = [&](parse_tuple_t& parsed, value_tuple_t& values) {
+                    return parse_stack(args, nargs, parsed, values);
+                };
+                return run(parse_fn, std::forward<Callback>(callback))
+                       == match_status::done;
+            }
+        }
+#endif
+
+        py_owned tuple {PyTuple_New(nargs)};
+        if (!tuple)
+        {
+            return false;
+        }
+        for (Py_ssize_t i = 0; i < nargs; i++)
+        {
+            PyTuple_SET_ITEM(tuple.get(), i, Py_NewRef(args[i]));
+        }
+
+        py_owned kwArgs;
+        Py_ssize_t nkw = kwnames ? PyTuple_GET_SIZE(kwnames) : 0;
+        if (nkw > 0)
+        {
+            kwArgs.reset(PyDict_New());
+            if (!kwArgs)
+            {
+                return false;
+            }
+            for (Py_ssize_t i = 0; i < nkw; i++)
+            {
+                if (PyDict_SetItem(kwArgs.get(), PyTuple_GET_ITEM(kwnames, i), args[nargs + i]) < 0)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return match(tuple.get(), kwArgs.get(), std::forward<Callback>(callback));
+    }
+
+    /**
+     * @brief Parses Python arguments and runs the callback on a background executor.
+     *
+     * Parsing happens synchronously in the calling thread (with the GIL held). The callback
+     * is then handed to the executor and an awaitable is returned immediately. The awaitable
+     * resolves with the callback's return value converted to Python (None for void), or with
+     * the exception raised during the conversion. C++ exceptions thrown by the callback are
+     * reported as RuntimeError.
+     *
+     * If an asyncio event loop is running in the calling thread the result is an asyncio
+     * Future bound to that loop, otherwise it is a concurrent.futures.Future.
+     *
+     * @tparam Callback Deduced callable type, validated like in match().
+     * @tparam Executor Callable receiving a move-only task. Defaults to a shared pool
+     *                  with one worker per hardware thread; tasks beyond that are queued.
+     *
+     * @return New reference to the future, or nullptr with a Python exception set if parsing
+     *         failed (in that case the callback is never scheduled).
+     *
+     * @par Example:
+     * @code
+     * static PyObject* slowMethod(PyObject* self, PyObject* args, PyObject* kwds) {
+     *     return args_spec.match_async(args, kwds, [](int n) { return expensive(n); });
+     * }
+     * // Python: result = await mod.slowMethod(10)
+     * @endcode
+     *
+     * @warning The callback runs without the GIL: it must not touch Python objects.
+     *          Parameter types owning Python references are rejected at compile time.
+     *          Parsed views and pointers stay valid until the callback returns because
+     *          args and kwArgs are kept alive for the duration of the task.
+     * @warning If the executor throws, it must not have run the task: the references are
+     *          released and RuntimeError is raised.
+     * @warning The interpreter must outlive all pending tasks.
+     */
+    template <typename Callback, typename Executor = detail::pool_executor>
+    auto match_async(PyObject* args,
+                     PyObject* kwArgs,
+                     Callback&& callback,
+                     Executor&& executor = {}) const -> PyObject*
+    {
+        using namespace detail;
+        using callback_t = std::decay_t<Callback>;
+
+        static_assert(is_callable_with_tuple_v<Callback, value_tuple_t>,
+                      "Lambda must be callable with the expected argument "
+                      "types from Arguments definition.");
+        static_assert(!any_gil_bound_v<value_tuple_t>,
+                      "match_async callbacks run without the GIL: arguments owning or using "
+                      "Python references (Py::Object, Borrowed, Lazy, VarKw, PyFunction) are "
+                      "not allowed, convert them to C++ values");
+
+        // Parsed storage must outlive this call, cleanup happens in the task
+        auto cleanup_defer = [args = this->args](parse_tuple_t* parsed) noexcept {
+            if (parsed)
+            {
+                apply_clean(*parsed, &args);
+                delete parsed;
+            }
+        };
+
+        std::unique_ptr<parse_tuple_t, decltype(cleanup_defer)> parsed {new parse_tuple_t {},
+                                                                         cleanup_defer};
+        apply_init(*parsed, &this->args);
+
+        value_tuple_t values {};
+        if (!parse(args, kwArgs, *parsed, values))
+        {
+            return nullptr;
+        }
+
+        PyObject* future = new_future();
+        if (!future)
+        {
+            return nullptr;
+        }
+
+        PyObject* awaitable = awaitable_future(future);
+        if (!awaitable)
+        {
+            Py_DECREF(future);
+            return nullptr;
+        }
+
+        // Keep the sources of borrowed values alive while the callback runs
+        Py_XINCREF(args);
+        Py_XINCREF(kwArgs);
+
+        auto task = [callback = callback_t(std::forward<Callback>(callback)),
+                     values = std::move(values),
+                     parsed = std::move(parsed),
+                     future,
+                     args,
+                     kwArgs]() mutable {
+            using result_t = std::decay_t<decltype(std::apply(callback, std::move(values)))>;
+            using stored_t = std::conditional_t<std::is_void_v<result_t>, std::monostate, result_t>;
+
+            // Run without the GIL
+            std::optional<stored_t> result;
+            std::string error;
+            try
+            {
+                if constexpr (std::is_void_v<result_t>)
+                {
+                    std::apply(callback, std::move(values));
+                    result.emplace();
+                }
+                else
+                {
+                    result.emplace(std::apply(callback, std::move(values)));
+                }
+            }
+            catch (const std::exception& exc)
+            {
+                error = exc.what();
+            }
+            catch (...)
+            {
+                error = "Unknown C++ exception in async callback";
+            }
+
+            // Convert, resolve and release everything under the GIL
+            PyGILState_STATE gil = PyGILState_Ensure();
+            PyObject* value = nullptr;
+            if (!result)
+            {
+                PyErr_SetString(PyExc_RuntimeError, error.c_str());
+            }
+            else if constexpr (std::is_void_v<result_t>)
+            {
+                value = Py_NewRef(Py_None);
+            }
+            else
+            {
+                value = to_python(std::move(*result));
+            }
+            resolve_future(future, value);
+            result.reset();
+            parsed.reset();
+            Py_DECREF(future);
+            Py_XDECREF(args);
+            Py_XDECREF(kwArgs);
+            PyGILState_Release(gil);
+        };
+
+        // future reference is owned by the task now, awaitable by the caller
+        try
+        {
+            std::forward<Executor>(executor)(std::move(task));
+        }
+        catch (const std::exception& exc)
+        {
+            // The task was not scheduled (e.g. std::system_error from std::thread)
+            Py_DECREF(future);
+            Py_DECREF(awaitable);
+            Py_XDECREF(args);
+            Py_XDECREF(kwArgs);
+            PyErr_Format(PyExc_RuntimeError, "cannot schedule async task: %s", exc.what());
+            return nullptr;
+        }
+        return awaitable;
+    }
+
+    /**
+     * @brief Runs one match attempt: parse_fn fills the parsed storage and the values, then
+     *        the callback is invoked. Shared by match() and match_vectorcall().
      *
-     * @param args Python tuple containing positional arguments (from PyObject* args parameter)
-     * @param kwArgs Python dict containing keyword arguments (from PyObject* kwds parameter)
-     * @param callback Callable object that accepts the parsed arguments as parameters.
-     *                 Must accept exactly the types specified in the Arguments definition.
+     * @return no_match if parsing failed, failed if the callback threw PythonError (the
+     *         Python exception is left set in both cases), done otherwise.
+     */
+    template <typename ParseFn, typename Callback>
+    auto run(ParseFn&& parse_fn, Callback&& callback) const -> detail::match_status
+    {
+        using namespace detail;
+
+        parse_tuple_t parsed {};
+
+        // Defer parsed cleanup (exceptions safe) [RAII]
+        auto cleanup_defer = [this](parse_tuple_t* parsed) noexcept {
+            if (parsed)
+            {
+                apply_clean(*parsed, &this->args);
+            }
+        };
+
+        [[maybe_unused]] std::unique_ptr<parse_tuple_t, decltype(cleanup_defer)> cleanup {
+            &parsed, cleanup_defer};
+
+        apply_init(parsed, &this->args);
+
+        value_tuple_t values {};
+        if (!parse_fn(parsed, values))
+        {
+            return match_status::no_match;
+        }
+
+        try
+        {
+            std::apply(std::forward<Callback>(callback), std::move(values));
+        }
+        catch (const PythonError&)
+        {
+            return match_status::failed;
+        }
+
+        return match_status::done;
+    }
+
+    /**
+     * @brief Parses args and kwArgs into the parsed storage and extracts the callback values.
      *
-     * @return true if parsing succeeded and callback was invoked, false otherwise.
-     *         On failure, a Python exception is set (accessible via PyErr_Occurred).
+     * Positional arguments beyond positional_count (with VarArgs) and undeclared keywords
+     * (with VarKw) are handed to the captures in place: signatures with captures are
+     * parsed item by item (see parse_items), so neither a head tuple nor a filtered
+     * keyword dict is made.
      *
-     * @par Example:
-     * @code
-     * auto args_spec = Arguments{
-     *     arg_int{"width"},
-     *     arg_int{"height"},
-     *     arg_string{"title"}
-     * };
+     * @return false with a Python exception set on failure.
+     */
+    auto parse(PyObject* args, PyObject* kwArgs, parse_tuple_t& parsed, value_tuple_t& values)
+        const -> bool
+    {
+        using namespace detail;
+
+        if constexpr (has_captures)
+        {
+            PyObject* const* items = args ? PySequence_Fast_ITEMS(args) : nullptr;
+            Py_ssize_t size = args ? PyTuple_GET_SIZE(args) : 0;
+            return parse_items(items, size, keyword_args {kwArgs}, parsed, values);
+        }
+        else
+        {
+            if (!PyArg_ParseTupleAndKeywords_Tuple(args, kwArgs, fmt.value, keywords, parsed))
+            {
+                return false;
+            }
+
+            apply_gets(parsed, values, &this->args);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Parses the declared arguments one by one, positionals straight from the items
+     *        array and keywords from kwargs, then fills the captures.
      *
-     * static PyObject* myMethod(PyObject* self, PyObject* args, PyObject* kwds) {
-     *     bool success = args_spec.match(args, kwds, [](int w, int h, std::string_view title) {
-     *         // Type-safe implementation - compiler ensures types match
-     *         std::cout << "Creating " << w << "x" << h << " window: " << title << "\n";
-     *     });
+     * Each value is converted with PyArg_Parse and the format unit of its argument, so
+     * the format units behave as in parse(). Keywords are looked up by their interned
+     * names. Used for signatures with captures: the parser would need a tuple of the
+     * declared head only and a dict of the declared keywords only.
      *
-     *     if (!success) {
-     *         return nullptr;  // Python exception already set
-     *     }
-     *     Py_RETURN_NONE;
-     * }
-     * @endcode
+     * @return false with a Python exception set on failure.
+     */
+    auto parse_items(PyObject* const* items,
+                     Py_ssize_t nargs,
+                     const detail::keyword_args& kwargs,
+                     parse_tuple_t& parsed,
+                     value_tuple_t& values) const -> bool
+    {
+        using namespace detail;
+
+        if (!has_var_args && nargs > positional_count)
+        {
+            PyErr_Format(PyExc_TypeError,
+                         "function takes at most %zd positional arguments (%zd given)",
+                         positional_count,
+                         nargs);
+            return false;
+        }
+
+        const auto* names = interned_keywords();
+        if (!names)
+        {
+            return false;
+        }
+
+        Py_ssize_t matched = 0;
+        if (!parse_item(items, nargs, kwargs, *names, parsed, matched))
+        {
+            return false;
+        }
+
+        keyword_names declared {names->data(), names->size()};
+        Py_ssize_t extra = kwargs.size() - matched;
+        if constexpr (!has_var_kw)
+        {
+            if (extra > 0)
+            {
+                set_unexpected_keyword(kwargs, declared);
+                return false;
+            }
+        }
+
+        apply_gets(parsed, values, &this->args);
+        call_context ctx {
+            items, nargs, std::min(nargs, positional_count), kwargs, extra, declared};
+        return apply_captures(ctx, values, &this->args);
+    }
+
+    /**
+     * @brief Parses argument Index of the declaration and the ones after it (parse_items).
      *
-     * @note The callback signature is validated at compile time. Compilation will fail
-     *       if the callback parameters don't match the argument specification.
-     * @note Memory management is automatic - temporary resources are cleaned up even
-     *       if the callback throws an exception.
-     * @note If parsing fails, a Python exception is set internally and must be handled
-     *       by the caller (typically by returning nullptr to Python).
+     * Pos is the first parse value of the argument, Keyword its index in keywords (and its
+     * position when passed by position). AfterOptional and AfterKwOnly track the markers
+     * seen.
+     */
+    template <std::size_t Index = 0,
+              std::size_t Pos = 0,
+              std::size_t Keyword = 0,
+              bool AfterOptional = false,
+              bool AfterKwOnly = false>
+    auto parse_item(PyObject* const* items,
+                    Py_ssize_t nargs,
+                    const detail::keyword_args& kwargs,
+                    const keyword_names_t& names,
+                    parse_tuple_t& parsed,
+                    Py_ssize_t& matched) const -> bool
+    {
+        using namespace detail;
+
+        if constexpr (Index == sizeof...(Args))
+        {
+            return true;
+        }
+        else
+        {
+            using arg_t = std::tuple_element_t<Index, std::tuple<Args...>>;
+            constexpr auto position = static_cast<Py_ssize_t>(Keyword);
+
+            if constexpr (std::is_same_v<arg_t, Arg<Optional>>)
+            {
+                return parse_item<Index + 1, Pos, Keyword, true, AfterKwOnly>(
+                    items, nargs, kwargs, names, parsed, matched);
+            }
+            else if constexpr (std::is_same_v<arg_t, Arg<KwOnly>>)
+            {
+                return parse_item<Index + 1, Pos, Keyword, AfterOptional, true>(
+                    items, nargs, kwargs, names, parsed, matched);
+            }
+            else if constexpr (arg_t::named)
+            {
+                PyObject* value = !AfterKwOnly && position < nargs ? items[position] : nullptr;
+
+                // Once every keyword is matched the rest are known to be absent
+                if (matched < kwargs.size())
+                {
+                    PyObject* by_name = kwargs.find(names[Keyword]);
+                    if (by_name)
+                    {
+                        ++matched;
+                        if (value)
+                        {
+                            PyErr_Format(PyExc_TypeError,
+                                         "argument for function given by name ('%s') and "
+                                         "position (%zd)",
+                                         keywords[Keyword],
+                                         position + 1);
+                            return false;
+                        }
+                        value = by_name;
+                    }
+                    else if (PyErr_Occurred())
+                    {
+                        return false;
+                    }
+                }
+
+                if (value)
+                {
+                    if (!PyArg_Parse_Tuple<Pos, arg_t::offset>(value, arg_t::fmt.value, parsed))
+                    {
+                        return false;
+                    }
+                }
+                else if constexpr (!AfterOptional)
+                {
+                    PyErr_Format(PyExc_TypeError,
+                                 "function missing required argument '%s' (pos %zd)",
+                                 keywords[Keyword],
+                                 position + 1);
+                    return false;
+                }
+
+                return parse_item<Index + 1,
+                                  Pos + arg_t::offset,
+                                  Keyword + 1,
+                                  AfterOptional,
+                                  AfterKwOnly>(items, nargs, kwargs, names, parsed, matched);
+            }
+            else
+            {
+                return parse_item<Index + 1, Pos, Keyword, AfterOptional, AfterKwOnly>(
+                    items, nargs, kwargs, names, parsed, matched);
+            }
+        }
+    }
+
+    /**
+     * @brief Interned names of the keywords, shared by the calls of all declarations with
+     *        the same keywords.
      *
-     * @warning The callback should not store references to string_view or pointer parameters
-     *          beyond its scope, as they may reference temporary storage.
+     * @return nullptr with a Python exception set if interning failed.
      */
-    template <bool Check = false, typename Callback>
-    auto match(PyObject* args, PyObject* kwArgs, Callback&& callback) const -> bool
+    auto interned_keywords() const -> const keyword_names_t*
+    {
+        static detail::keyword_cache<keyword_count> cache;
+        return cache.find(keywords);
+    }
+
+#if !defined(Py_LIMITED_API) && PY_VERSION_HEX < 0x030D0000
+    /**
+     * @brief Parses the positionals of a keyword-less vectorcall into the parsed storage,
+     *        without building an argument tuple. Only used when stack_parsable holds.
+     *
+     * @return false with a Python exception set on failure.
+     */
+    auto parse_stack(PyObject* const* args,
+                     Py_ssize_t nargs,
+                     parse_tuple_t& parsed,
+                     value_tuple_t& values) const -> bool
+    {
+        using namespace detail;
+
+        if (!PyArg_ParseStack_Tuple(args, nargs, fmt.value, parsed))
+        {
+            return false;
+        }
+
+        apply_gets(parsed, values, &this->args);
+        return true;
+    }
+#endif
+
+    FmtString<fmt_size<decltype(Args::fmt)...>> fmt {};
+    std::array<const char*, keyword_count + 1> keywords {};
+    args_tuple_t args {};
+};
+
+template <typename... Ts>
+Arguments(Ts&&...) -> Arguments<Ts...>;
+
+namespace detail
+{
+
+// Helper: dispatch to the first match
+template <typename... ArgsAndCallbacks, std::size_t... I>
+inline auto dispatch_overloads_impl(PyObject* args,
+                                    PyObject* kwArgs,
+                                    std::tuple<ArgsAndCallbacks...>&& args_tuple,
+                                    std::index_sequence<I...>)
+{
+    match_status status = match_status::no_match;
+
+    // Stops at the first overload that parses, whether its callback succeeds or not
+    (void)(false || ... || [&] {
+        constexpr std::size_t args_idx = I * 2;
+        constexpr std::size_t callback_idx = I * 2 + 1;
+
+        auto& arguments = std::get<args_idx>(args_tuple);
+        auto& callback = std::get<callback_idx>(args_tuple);
+
+        using value_tuple_t = typename std::decay_t<decltype(arguments)>::value_tuple_t;
+        static_assert(is_callable_with_tuple_v<decltype(callback), value_tuple_t>,
+                      "Lambda must be callable with the expected argument "
+                      "types from Arguments definition.");
+
+        if constexpr (I > 0)
+        {
+            // Discard the parse error of the previous overload
+            PyErr_Clear();
+        }
+
+        auto parse_fn = [&](auto& parsed, auto& values) {
+            return arguments.parse(args, kwArgs, parsed, values);
+        };
+        status = arguments.run(parse_fn, callback);
+        return status != match_status::no_match;
+    }());
+
+    return status == match_status::done;
+}
+
+} // namespace detail
+
+/**
+ * @brief Dispatches Python arguments to the first matching overload.
+ *
+ * Provides function overloading for Python C API methods by attempting to match
+ * the provided arguments against multiple argument specifications in order.
+ * The first specification that successfully parses the arguments will have its
+ * callback invoked. This enables type-safe function overloading similar to C++.
+ *
+ * The function accepts alternating pairs of Arguments specifications and callbacks.
+ * It attempts to match arguments in the order provided and stops at the first success.
+ * This is similar to how Python's @overload decorator or C++ function overloading works.
+ *
+ * @tparam ArgsAndCallbacks Deduced variadic template parameters representing
+ *                          alternating Arguments and callback pairs.
+ *
+ * @param args Python tuple containing positional arguments (from PyObject* args parameter)
+ * @param kwArgs Python dict containing keyword arguments (from PyObject* kwds parameter)
+ * @param args_and_callbacks Variadic list of alternating Arguments objects and callbacks.
+ *                          Must be provided in pairs: Arguments1, callback1, Arguments2, callback2,
+ * ...
+ *
+ * @return true if any overload matched and executed successfully, false if no overload matched
+ *         or if the callback of the matching overload failed.
+ *
+ * @par Example - Simple Overloading:
+ * @code
+ * // Define multiple overloads
+ * auto overload1 = Arguments{arg_int{"value"}};
+ * auto overload2 = Arguments{arg_string{"text"}};
+ * auto overload3 = Arguments{arg_int{"x"}, arg_int{"y"}};
+ *
+ * static PyObject* myMethod(PyObject* self, PyObject* args, PyObject* kwds) {
+ *     bool success = dispatch_overloads(
+ *         args, kwds,
+ *         // Overload 1: single integer
+ *         overload1, [](int value) {
+ *             std::cout << "Called with int: " << value << "\n";
+ *         },
+ *         // Overload 2: single string
+ *         overload2, [](std::string_view text) {
+ *             std::cout << "Called with string: " << text << "\n";
+ *         },
+ *         // Overload 3: two integers
+ *         overload3, [](int x, int y) {
+ *             std::cout << "Called with point: (" << x << ", " << y << ")\n";
+ *         }
+ *     );
+ *
+ *     if (!success) {
+ *         return nullptr;  // No overload matched or parsing failed
+ *     }
+ *     Py_RETURN_NONE;
+ * }
+ * @endcode
+ *
+ * @par Example - With Optional Arguments:
+ * @code
+ * auto no_args = Arguments{};
+ * auto with_title = Arguments{arg_string{"title"}};
+ * auto with_size = Arguments{arg_int{"width"}, arg_int{"height"}};
+ *
+ * dispatch_overloads(
+ *     args, kwds,
+ *     with_size, [](int w, int h) {
+ *         std::cout << "Size: " << w << "x" << h << "\n";
+ *     },
+ *     with_title, [](std::string_view title) {
+ *         std::cout << "Title: " << title << "\n";
+ *     },
+ *     no_args, []() {
+ *         std::cout << "No arguments\n";
+ *     }
+ * );
+ * @endcode
+ *
+ * @note Overloads are tried in the order they are provided. Place more specific
+ *       overloads before more general ones to ensure correct matching.
+ * @note Each callback must match the exact types specified in its corresponding
+ *       Arguments specification (compile-time checked).
+ * @note If no overload matches, the Python exception of the last attempted overload
+ *       is set. Consider providing a catch-all overload if needed.
+ * @note A callback failing with PythonError stops the dispatch: false is returned with
+ *       the callback's Python exception left set, and no further overload is tried.
+ * @note The number of arguments must be even (pairs of Arguments and callbacks),
+ *       enforced by static_assert at compile time.
+ *
+ * @see Arguments
+ * @see Arguments::match
+ */
+template <typename... ArgsAndCallbacks>
+inline auto dispatch_overloads(PyObject* args,
+                               PyObject* kwArgs,
+                               ArgsAndCallbacks&&... args_and_callbacks)
+{
+    static_assert(sizeof...(args_and_callbacks) % 2 == 0,
+                  "Arguments must come in pairs: Arguments object and callback");
+
+    auto tuple = std::forward_as_tuple(args_and_callbacks...);
+    constexpr std::size_t num_pairs = sizeof...(args_and_callbacks) / 2;
+
+    return detail::dispatch_overloads_impl(
+        args, kwArgs, std::move(tuple), std::make_index_sequence<num_pairs> {});
+}
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Common encodings                                                         │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+struct enc_utf8
+{
+    static constexpr auto parse_ptr_value() { return "utf-8"; }
+};
+
+struct enc_utf16
+{
+    static constexpr auto parse_ptr_value() { return "utf-16"; }
+};
+
+struct enc_utf32
+{
+    static constexpr auto parse_ptr_value() { return "utf-32"; }
+};
+
+struct enc_ascii
+{
+    static constexpr auto parse_ptr_value() { return "ascii"; }
+};
+
+struct enc_latin1
+{
+    static constexpr auto parse_ptr_value() { return "latin1"; }
+};
+
+struct enc_iso8859
+{
+    static constexpr auto parse_ptr_value() { return "iso8859"; }
+};
+
+struct enc_iso8859_1
+{
+    static constexpr auto parse_ptr_value() { return "iso8859-1"; }
+};
+
+// ┌──────────────────────────────────────────────────────────────────────────┐
+// │ Convenience aliases                                                      │
+// └──────────────────────────────────────────────────────────────────────────┘
+
+using arg_uchar = Arg<unsigned char>;
+using arg_bool = Arg<Bool>;
+using arg_short = Arg<short>;
+using arg_ushort = Arg<unsigned short>;
+using arg_int = Arg<int>;
+using arg_uint = Arg<unsigned int>;
+using arg_long = Arg<long>;
+using arg_ulong = Arg<unsigned long>;
+using arg_llong = Arg<long long>;
+using arg_ullong = Arg<unsigned long long>;
+using arg_ssize = Arg<SSize>;
+using arg_1byte = Arg<Byte1>;
+using arg_1char = Arg<Char1>;
+using arg_float = Arg<float>;
+using arg_double = Arg<double>;
+using arg_cstr = Arg<c_str_t>;
+using arg_string = Arg<std::string>;
+using arg_string_v = Arg<std::string_view>;
+using arg_pos_only = Arg<PosOnly>;
+using arg_kw_only = Arg<KwOnly>;
+using arg_optionals = Arg<Optional>;
+using arg_object = Arg<PyObject*>;
+using arg_tuple = Arg<Tuple>;
+using arg_dict = Arg<Dict>;
+using arg_nnbyte = Arg<NNByte>;
+using arg_fspath = Arg<FSPath>;
+
+template <typename Encoding>
+using arg_enc_cstr = ArgEncCStr<Encoding>;
+
+// ╔══════════════════════════════════════════════════════════════════════════╗
+// ║ PyCXX Types                                                              ║
+// ╚══════════════════════════════════════════════════════════════════════════╝
+
+namespace cxx = ::Py; // PyCXX
+
+} // namespace Base::PyArgs
+
+namespace Py
+{
+struct PythonClassInstance;
+
+template <typename T>
+class PythonClass;
+} // namespace Py
+
+namespace Base::PyArgs
+{
+
+struct TupleType
+{
+    static constexpr auto parse_ptr_value() { return &PyTuple_Type; }
+};
+
+struct DictType
+{
+    static constexpr auto parse_ptr_value() { return &PyDict_Type; }
+};
+
+struct ListType
+{
+    static constexpr auto parse_ptr_value() { return &PyList_Type; }
+};
+
+struct BytesType
+{
+    static constexpr auto parse_ptr_value() { return &PyBytes_Type; }
+};
+
+struct UnicodeType
+{
+    static constexpr auto parse_ptr_value() { return &PyUnicode_Type; }
+};
+
+template <typename T>
+struct PyCxxArg : named_arg
+{
+    using value_type = detail::type_list<T>;
+    using parse_type = detail::type_list<PyObject*>;
+
+    static constexpr FmtString fmt {"O"};
+    static constexpr std::size_t offset = 1;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static auto get(std::tuple<Args...>& tuple) -> T
+    {
+        auto* ptr = static_cast<PyObject*>(std::get<Offset>(tuple));
+        return T {ptr};
+    }
+};
+
+// PyCXX wrapper of a checked type. The parser already checked the type, so
+// the wrapper is built without running PyCXX validation again.
+template <typename T, typename PyType, bool Exact = false>
+struct PyCxxExtArg : named_arg
+{
+    using converter_t = detail::converter<&detail::check_type<PyType::parse_ptr_value(), Exact>>;
+    using value_type = detail::type_list<T>;
+    using parse_type = detail::type_list<converter_t, PyObject*>;
+    using exact_arg = PyCxxExtArg<T, PyType, true>;
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static auto get(std::tuple<Args...>& tuple) -> T
+    {
+        auto* ptr = static_cast<PyObject*>(std::get<Offset + 1>(tuple));
+        return T {ptr, false, cxx::prechecked_t {}};
+    }
+};
+
+template <>
+struct Arg<cxx::Object> : PyCxxArg<cxx::Object>
+{};
+
+template <>
+struct Arg<cxx::Tuple> : PyCxxExtArg<cxx::Tuple, TupleType>
+{};
+
+template <>
+struct Arg<cxx::Dict> : PyCxxExtArg<cxx::Dict, DictType>
+{};
+
+template <>
+struct Arg<cxx::List> : PyCxxExtArg<cxx::List, ListType>
+{};
+
+// Callable is checked by the parser too, so a Borrowed<cxx::Callable> view
+// (which skips PyCXX validation) never wraps a non-callable object
+template <>
+struct Arg<cxx::Callable> : named_arg
+{
+    using value_type = detail::type_list<cxx::Callable>;
+    using parse_type = detail::type_list<detail::converter<&detail::convert_callable>, PyObject*>;
+
+    static constexpr FmtString fmt {"O&"};
+    static constexpr std::size_t offset = 2;
+
+    template <std::size_t Offset, typename... Args>
+    static constexpr void init(std::tuple<Args...>& tuple)
+    {
+        std::get<Offset + 1>(tuple) = nullptr;
+    }
+
+    template <std::size_t Offset, typename... Args>
+    static auto get(std::tuple<Args...>& tuple) -> cxx::Callable
+    {
+        auto* ptr = static_cast<PyObject*>(std::get<Offset + 1>(tuple));
+        return cxx::Callable {ptr, false, cxx::prechecked_t {}};
+    }
+};
+
+template <>
+struct Arg<cxx::Bytes> : PyCxxExtArg<cxx::Bytes, BytesType>
+{};
+
+template <>
+struct Arg<cxx::String> : PyCxxExtArg<cxx::String, UnicodeType>
+{};
+
+// Borrowed PyCXX wrapper: parsed like Arg<T>, passed to the callback as a view
+// that does not touch the reference count (valid during the callback only)
+template <typename T>
+struct Arg<cxx::Borrowed<T>> : Arg<T>
+{
+    using value_type = detail::type_list<cxx::Borrowed<T>>;
+
+    template <std::size_t Offset, typename... Args>
+    static auto get(std::tuple<Args...>& tuple) -> cxx::Borrowed<T>
+    {
+        auto* ptr = static_cast<PyObject*>(std::get<Offset + Arg<T>::offset - 1>(tuple));
+        return cxx::Borrowed<T> {ptr};
+    }
+};
+
+using arg_String = Arg<cxx::String>;
+using arg_Bytes = Arg<cxx::Bytes>;
+using arg_List = Arg<cxx::List>;
+using arg_Tuple = Arg<cxx::Tuple>;
+using arg_Dict = Arg<cxx::Dict>;
+using arg_Callable = Arg<cxx::Callable>;
+using arg_Object = Arg<cxx::Object>;
+
+// ╔══════════════════════════════════════════════════════════════════════════╗
+// ║ PyCXX Vectorcall Constructors                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════╝
+
+namespace detail
+{
+
+// Callback constructing T(self, values...), with the exact parameter types match() expects
+template <typename T, typename Instance, typename Tuple>
+struct class_init;
+
+template <typename T, typename Instance, typename... Ts>
+struct class_init<T, Instance, std::tuple<Ts...>>
+{
+    Instance* self;
+
+    void operator()(Ts... values) const
     {
-        using namespace detail;
+        self->m_pycxx_object = new T(self, std::move(values)...);
+    }
+};
 
-        static_assert(is_callable_with_tuple_v<Callback, value_tuple_t>,
-                      "Lambda must be callable with the expected argument "
-                      "types from Arguments definition.");
+} // namespace detail
 
-        if constexpr (Check)
-        {
-            if ((args == nullptr || !PyTuple_Check(args))
-                || (kwArgs != nullptr && !PyDict_Check(kwArgs)))
-            {
-                PyErr_BadInternalCall();
-                return false;
-            }
-        }
+/**
+ * @brief Typed vectorcall constructor for PyCXX PythonClass<T> types.
+ *
+ * Parses the call with Signature and constructs T from the parsed values,
+ * as T(self, values...). Register it in T::init_type with
+ * set_vectorcall_init<&vectorcall_init<T, T::signature>>().
+ *
+ * @code
+ * class Vec : public Py::PythonClass<Vec>
+ * {
+ *     static constexpr Arguments signature {arg_double{"x"}, arg_double{"y"}};
+ *     Vec(Py::PythonClassInstance* self, double x, double y);
+ *     ...
+ * };
+ * @endcode
+ */
+template <typename T, const auto& Signature, typename Instance = cxx::PythonClassInstance>
+inline auto vectorcall_init(Instance* self,
+                            PyObject* const* args,
+                            std::size_t nargsf,
+                            PyObject* kwnames) -> bool
+{
+    using values_t = typename std::remove_cvref_t<decltype(Signature)>::value_tuple_t;
+    return Signature.match_vectorcall(args,
+                                      nargsf,
+                                      kwnames,
+                                      detail::class_init<T, Instance, values_t> {self});
+}
 
-        parse_tuple_t parsed {};
+// ╔══════════════════════════════════════════════════════════════════════════╗
+// ║ PyCXX Typed Slots                                                        ║
+// ╚══════════════════════════════════════════════════════════════════════════╝
 
-        // Defer parsed cleanup (exceptions safe) [RAII]
-        auto cleanup_defer = [this](parse_tuple_t* parsed) noexcept {
-            if (parsed)
-            {
-                apply_clean(*parsed, &this->args);
-            }
-        };
+namespace detail
+{
 
-        [[maybe_unused]] std::unique_ptr<parse_tuple_t, decltype(cleanup_defer)> cleanup {
-            &parsed, cleanup_defer};
+// Class, result and parameter types of a member function pointer
+template <typename M>
+struct method_traits;
 
-        apply_init(parsed, &this->args);
+template <typename R, typename C, typename... A>
+struct method_traits<R (C::*)(A...)>
+{
+    using class_type = C;
+    using result_type = R;
+    using args = std::tuple<A...>;
+};
+
+template <typename R, typename C, typename... A>
+struct method_traits<R (C::*)(A...) const> : method_traits<R (C::*)(A...)>
+{};
+
+template <typename R, typename C, typename... A>
+struct method_traits<R (C::*)(A...) noexcept> : method_traits<R (C::*)(A...)>
+{};
+
+template <typename R, typename C, typename... A>
+struct method_traits<R (C::*)(A...) const noexcept> : method_traits<R (C::*)(A...)>
+{};
+
+template <auto Method, std::size_t I>
+using method_arg_t = std::tuple_element_t<I, typename method_traits<decltype(Method)>::args>;
+
+// PyCXX extension classes (PythonClass<T> and PythonExtension<T>)
+template <typename T>
+concept extension_class = std::is_class_v<T> && requires { T::type_object(); };
 
-        int result = PyArg_ParseTupleAndKeywords_Tuple(args, kwArgs, fmt.value, keywords, parsed);
-        if (result)
+// C++ object behind a PyCXX extension instance, nullptr with an exception
+// set if the instance was never initialized
+template <typename C, typename Instance = cxx::PythonClassInstance>
+inline auto extension_object(PyObject* obj) -> C*
+{
+    if constexpr (!std::is_base_of_v<cxx::PythonClass<C>, C>)
+    {
+        // PythonExtension<T> objects are the Python object
+        return static_cast<C*>(obj);
+    }
+    else
+    {
+        auto* object = reinterpret_cast<Instance*>(obj)->m_pycxx_object;
+        if (!object)
         {
-            value_tuple_t values {};
-            apply_gets(parsed, values, &this->args);
-            std::apply(std::forward<Callback>(callback), std::move(values));
+            PyErr_Format(PyExc_TypeError,
+                         "%.200s object is not initialized",
+                         Py_TYPE(obj)->tp_name);
+            return nullptr;
         }
+        return static_cast<C*>(object);
+    }
+}
+
+// Slot operand converted for a parameter of type A. Extension classes are
+// referenced in place, anything else goes through from_python.
+template <typename A>
+struct slot_operand
+{
+    using type = std::remove_cvref_t<A>;
+    static constexpr bool is_extension = extension_class<type>;
+
+    std::conditional_t<is_extension, type*, type> value {};
 
-        return result != 0;
+    auto convert(PyObject* obj) -> bool
+    {
+        if constexpr (is_extension)
+        {
+            if (!PyObject_TypeCheck(obj, type::type_object()))
+            {
+                PyErr_Format(PyExc_TypeError,
+                             "expected %.200s, got %.200s",
+                             type::type_object()->tp_name,
+                             Py_TYPE(obj)->tp_name);
+                return false;
+            }
+            value = extension_object<type>(obj);
+            return value != nullptr;
+        }
+        else
+        {
+            return from_python(obj, value);
+        }
     }
 
-    FmtString<fmt_size<decltype(Args::fmt)...>> fmt {};
-    std::array<const char*, detail::count_keywords<Args...> + 1> keywords {};
-    args_tuple_t args {};
+    auto get() -> A
+    {
+        if constexpr (is_extension)
+        {
+            return static_cast<A>(*value);
+        }
+        else
+        {
+            return static_cast<A>(value);
+        }
+    }
 };
 
-template <typename... Ts>
-Arguments(Ts&&...) -> Arguments<Ts...>;
+// Conversion failures of binary operators become NotImplemented
+inline auto not_implemented_on_type_error() -> PyObject*
+{
+    if (!PyErr_ExceptionMatches(PyExc_TypeError))
+    {
+        return nullptr;
+    }
+    PyErr_Clear();
+    return Py_NewRef(Py_NotImplemented);
+}
 
-namespace detail
+// Run fn, false if it threw with a Python exception set
+template <typename Fn>
+inline auto slot_guard(Fn&& fn) -> bool
 {
+    try
+    {
+        std::forward<Fn>(fn)();
+        return true;
+    }
+    catch (const PythonError&)
+    {
+        return false;
+    }
+    catch (const cxx::BaseException&)
+    {
+        return false;
+    }
+}
 
-// Helper: dispatch to the first match
-template <typename... ArgsAndCallbacks, std::size_t... I>
-inline auto dispatch_overloads_impl(PyObject* args,
-                                    PyObject* kwArgs,
-                                    std::tuple<ArgsAndCallbacks...>&& args_tuple,
-                                    std::index_sequence<I...>)
+// Call Method on self and convert its result to a new reference. Extension
+// classes returned by value become new instances without calling the type.
+template <auto Method, typename C, typename... Values>
+inline auto slot_result(C* self, Values&&... values) -> PyObject*
 {
-    return (false || ... || [&] {
-        constexpr std::size_t args_idx = I * 2;
-        constexpr std::size_t callback_idx = I * 2 + 1;
+    using result_t = typename method_traits<decltype(Method)>::result_type;
 
-        auto& arguments = std::get<args_idx>(args_tuple);
-        auto& callback = std::get<callback_idx>(args_tuple);
+    PyObject* result = nullptr;
+    slot_guard([&] {
+        if constexpr (extension_class<std::remove_cvref_t<result_t>>)
+        {
+            static_assert(std::is_base_of_v<cxx::PythonClass<result_t>, result_t>,
+                          "Extension class results must be PythonClass<T> returned by value");
+            result = result_t::new_instance(
+                [&] { return (self->*Method)(std::forward<Values>(values)...); });
+        }
+        else
+        {
+            result = to_python((self->*Method)(std::forward<Values>(values)...));
+        }
+    });
+    return result;
+}
 
-        return arguments.match(args, kwArgs, callback);
-    }());
+// Binary operator with self on one side, NotImplemented for other operands
+template <auto Method>
+inline auto binary_operand_slot(PyObject* self, PyObject* other) -> PyObject*
+{
+    using C = typename method_traits<decltype(Method)>::class_type;
+    C* object = extension_object<C>(self);
+    if (!object)
+    {
+        return nullptr;
+    }
+    slot_operand<method_arg_t<Method, 0>> operand;
+    if (!operand.convert(other))
+    {
+        return not_implemented_on_type_error();
+    }
+    return slot_result<Method>(object, operand.get());
 }
 
 } // namespace detail
 
 /**
- * @brief Dispatches Python arguments to the first matching overload.
- *
- * Provides function overloading for Python C API methods by attempting to match
- * the provided arguments against multiple argument specifications in order.
- * The first specification that successfully parses the arguments will have its
- * callback invoked. This enables type-safe function overloading similar to C++.
- *
- * The function accepts alternating pairs of Arguments specifications and callbacks.
- * It attempts to match arguments in the order provided and stops at the first success.
- * This is similar to how Python's @overload decorator or C++ function overloading works.
- *
- * @tparam ArgsAndCallbacks Deduced variadic template parameters representing
- *                          alternating Arguments and callback pairs.
- *
- * @param args Python tuple containing positional arguments (from PyObject* args parameter)
- * @param kwArgs Python dict containing keyword arguments (from PyObject* kwds parameter)
- * @param args_and_callbacks Variadic list of alternating Arguments objects and callbacks.
- *                          Must be provided in pairs: Arguments1, callback1, Arguments2, callback2,
- * ...
- *
- * @return true if any overload matched and executed successfully, false if no overload matched
- *         or if an error occurred during parsing.
+ * @brief Typed slot functions for PyCXX extension classes.
  *
- * @par Example - Simple Overloading:
- * @code
- * // Define multiple overloads
- * auto overload1 = Arguments{arg_int{"value"}};
- * auto overload2 = Arguments{arg_string{"text"}};
- * auto overload3 = Arguments{arg_int{"x"}, arg_int{"y"}};
- *
- * static PyObject* myMethod(PyObject* self, PyObject* args, PyObject* kwds) {
- *     bool success = dispatch_overloads(
- *         args, kwds,
- *         // Overload 1: single integer
- *         overload1, [](int value) {
- *             std::cout << "Called with int: " << value << "\n";
- *         },
- *         // Overload 2: single string
- *         overload2, [](std::string_view text) {
- *             std::cout << "Called with string: " << text << "\n";
- *         },
- *         // Overload 3: two integers
- *         overload3, [](int x, int y) {
- *             std::cout << "Called with point: (" << x << ", " << y << ")\n";
- *         }
- *     );
- *
- *     if (!success) {
- *         return nullptr;  // No overload matched or parsing failed
- *     }
- *     Py_RETURN_NONE;
- * }
- * @endcode
+ * Each template turns a typed member function of a PythonClass<T> or
+ * PythonExtension<T> into the C function of a type slot, to be installed with
+ * PythonType::set_slot. The member is called directly: operands are converted
+ * with from_python (or referenced in place for extension classes), the result
+ * with to_python, and failures are reported through the slot return value.
+ * PythonClass<T> results returned by value become new instances directly
+ * (PythonClass::new_instance), built in place without calling the type:
+ * construct them with a null self. Py::BaseException and PythonError thrown by the
+ * member are still honoured. set_slot rejects functions installed in a slot
+ * of another signature.
  *
- * @par Example - With Optional Arguments:
  * @code
- * auto no_args = Arguments{};
- * auto with_title = Arguments{arg_string{"title"}};
- * auto with_size = Arguments{arg_int{"width"}, arg_int{"height"}};
- *
- * dispatch_overloads(
- *     args, kwds,
- *     with_size, [](int w, int h) {
- *         std::cout << "Size: " << w << "x" << h << "\n";
- *     },
- *     with_title, [](std::string_view title) {
- *         std::cout << "Title: " << title << "\n";
- *     },
- *     no_args, []() {
- *         std::cout << "No arguments\n";
- *     }
- * );
+ * // Vec operator+(const Vec&) const, Vec scale(double) const
+ * behaviors().set_slot(Py_nb_add, binary_slot<&Vec::operator+>);
+ * behaviors().set_slot(Py_nb_multiply, binary_slot<&Vec::scale, &Vec::scale>);
+ * // Py_ssize_t size() const, double item(Py_ssize_t) const
+ * behaviors().set_slot(Py_sq_length, length_slot<&Vec::size>);
+ * behaviors().set_slot(Py_sq_item, item_slot<&Vec::item>);
+ * behaviors().set_slot(Py_tp_richcompare, richcompare_slot<&Vec::compare>);
  * @endcode
  *
- * @note Overloads are tried in the order they are provided. Place more specific
- *       overloads before more general ones to ensure correct matching.
- * @note Each callback must match the exact types specified in its corresponding
- *       Arguments specification (compile-time checked).
- * @note If no overload matches, a Python exception may be set by the last attempted
- *       parse. Consider providing a catch-all overload if needed.
- * @note The number of arguments must be even (pairs of Arguments and callbacks),
- *       enforced by static_assert at compile time.
- *
- * @see Arguments
- * @see Arguments::match
+ * @note Number operators return NotImplemented when the operand does not
+ *       convert (TypeError), so Python can try the other operand. Reflected
+ *       calls (other + self) use the optional Reflected member.
  */
-template <typename... ArgsAndCallbacks>
-inline auto dispatch_overloads(PyObject* args,
-                               PyObject* kwArgs,
-                               ArgsAndCallbacks&&... args_and_callbacks)
+template <auto Method, auto Reflected = nullptr>
+inline auto binary_slot(PyObject* left, PyObject* right) -> PyObject*
 {
-    static_assert(sizeof...(args_and_callbacks) % 2 == 0,
-                  "Arguments must come in pairs: Arguments object and callback");
-
-    auto tuple = std::forward_as_tuple(args_and_callbacks...);
-    constexpr std::size_t num_pairs = sizeof...(args_and_callbacks) / 2;
-
-    return detail::dispatch_overloads_impl(
-        args, kwArgs, std::move(tuple), std::make_index_sequence<num_pairs> {});
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    if (PyObject_TypeCheck(left, C::type_object()))
+    {
+        return detail::binary_operand_slot<Method>(left, right);
+    }
+    if constexpr (!std::is_null_pointer_v<decltype(Reflected)>)
+    {
+        if (PyObject_TypeCheck(right, C::type_object()))
+        {
+            return detail::binary_operand_slot<Reflected>(right, left);
+        }
+    }
+    return Py_NewRef(Py_NotImplemented);
 }
 
-// ┌──────────────────────────────────────────────────────────────────────────┐
-// │ Common encodings                                                         │
-// └──────────────────────────────────────────────────────────────────────────┘
-
-struct enc_utf8
+// unaryfunc: R method() for nb_negative, nb_absolute, nb_float, tp_repr, ...
+template <auto Method>
+inline auto unary_slot(PyObject* self) -> PyObject*
 {
-    static constexpr auto parse_ptr_value() { return "utf-8"; }
-};
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    C* object = detail::extension_object<C>(self);
+    return object ? detail::slot_result<Method>(object) : nullptr;
+}
 
-struct enc_utf16
+// lenfunc: Py_ssize_t method() for sq_length and mp_length
+template <auto Method>
+inline auto length_slot(PyObject* self) -> Py_ssize_t
 {
-    static constexpr auto parse_ptr_value() { return "utf-16"; }
-};
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    C* object = detail::extension_object<C>(self);
+    Py_ssize_t result = -1;
+    if (object)
+    {
+        detail::slot_guard([&] { result = static_cast<Py_ssize_t>((object->*Method)()); });
+    }
+    return result;
+}
 
-struct enc_utf32
+// hashfunc: integral method() for tp_hash
+template <auto Method>
+inline auto hash_slot(PyObject* self) -> Py_hash_t
 {
-    static constexpr auto parse_ptr_value() { return "utf-32"; }
-};
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    C* object = detail::extension_object<C>(self);
+    Py_hash_t result = -1;
+    if (object && detail::slot_guard([&] { result = static_cast<Py_hash_t>((object->*Method)()); }))
+    {
+        // -1 is reserved for errors
+        result = result == -1 ? -2 : result;
+    }
+    return result;
+}
 
-struct enc_ascii
+// ssizeargfunc: R method(Py_ssize_t) for sq_item, indexes are already adjusted by len()
+template <auto Method>
+inline auto item_slot(PyObject* self, Py_ssize_t index) -> PyObject*
 {
-    static constexpr auto parse_ptr_value() { return "ascii"; }
-};
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    C* object = detail::extension_object<C>(self);
+    return object ? detail::slot_result<Method>(object, index) : nullptr;
+}
 
-struct enc_latin1
+// ssizeobjargproc: void method(Py_ssize_t, V) for sq_ass_item, del is not supported
+template <auto Method>
+inline auto ass_item_slot(PyObject* self, Py_ssize_t index, PyObject* value) -> int
 {
-    static constexpr auto parse_ptr_value() { return "latin1"; }
-};
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    if (!value)
+    {
+        PyErr_Format(PyExc_TypeError,
+                     "%.200s does not support item deletion",
+                     Py_TYPE(self)->tp_name);
+        return -1;
+    }
+    C* object = detail::extension_object<C>(self);
+    detail::slot_operand<detail::method_arg_t<Method, 1>> operand;
+    if (!object || !operand.convert(value))
+    {
+        return -1;
+    }
+    return detail::slot_guard([&] { (object->*Method)(index, operand.get()); }) ? 0 : -1;
+}
 
-struct enc_iso8859
+// binaryfunc: R method(K) for mp_subscript
+template <auto Method>
+inline auto subscript_slot(PyObject* self, PyObject* key) -> PyObject*
 {
-    static constexpr auto parse_ptr_value() { return "iso8859"; }
-};
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    C* object = detail::extension_object<C>(self);
+    detail::slot_operand<detail::method_arg_t<Method, 0>> operand;
+    if (!object || !operand.convert(key))
+    {
+        return nullptr;
+    }
+    return detail::slot_result<Method>(object, operand.get());
+}
 
-struct enc_iso8859_1
+// objobjargproc: void method(K, V) for mp_ass_subscript, del is not supported
+template <auto Method>
+inline auto ass_subscript_slot(PyObject* self, PyObject* key, PyObject* value) -> int
 {
-    static constexpr auto parse_ptr_value() { return "iso8859-1"; }
-};
-
-// ┌──────────────────────────────────────────────────────────────────────────┐
-// │ Convenience aliases                                                      │
-// └──────────────────────────────────────────────────────────────────────────┘
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    if (!value)
+    {
+        PyErr_Format(PyExc_TypeError,
+                     "%.200s does not support item deletion",
+                     Py_TYPE(self)->tp_name);
+        return -1;
+    }
+    C* object = detail::extension_object<C>(self);
+    detail::slot_operand<detail::method_arg_t<Method, 0>> key_operand;
+    detail::slot_operand<detail::method_arg_t<Method, 1>> value_operand;
+    if (!object || !key_operand.convert(key) || !value_operand.convert(value))
+    {
+        return -1;
+    }
+    return detail::slot_guard([&] { (object->*Method)(key_operand.get(), value_operand.get()); })
+        ? 0
+        : -1;
+}
 
-using arg_uchar = Arg<unsigned char>;
-using arg_bool = Arg<Bool>;
-using arg_short = Arg<short>;
-using arg_ushort = Arg<unsigned short>;
-using arg_int = Arg<int>;
-using arg_uint = Arg<unsigned int>;
-using arg_long = Arg<long>;
-using arg_ulong = Arg<unsigned long>;
-using arg_llong = Arg<long long>;
-using arg_ullong = Arg<unsigned long long>;
-using arg_ssize = Arg<SSize>;
-using arg_1byte = Arg<Byte1>;
-using arg_1char = Arg<Char1>;
-using arg_float = Arg<float>;
-using arg_double = Arg<double>;
-using arg_cstr = Arg<c_str_t>;
-using arg_string = Arg<std::string>;
-using arg_string_v = Arg<std::string_view>;
-using arg_pos_only = Arg<PosOnly>;
-using arg_kw_only = Arg<KwOnly>;
-using arg_optionals = Arg<Optional>;
-using arg_object = Arg<PyObject*>;
-using arg_tuple = Arg<Tuple>;
-using arg_dict = Arg<Dict>;
-using arg_nnbyte = Arg<NNByte>;
-using arg_fspath = Arg<FSPath>;
+// objobjproc: bool method(K) for sq_contains, keys that do not convert are not contained
+template <auto Method>
+inline auto contains_slot(PyObject* self, PyObject* key) -> int
+{
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    C* object = detail::extension_object<C>(self);
+    if (!object)
+    {
+        return -1;
+    }
+    detail::slot_operand<detail::method_arg_t<Method, 0>> operand;
+    if (!operand.convert(key))
+    {
+        if (!PyErr_ExceptionMatches(PyExc_TypeError))
+        {
+            return -1;
+        }
+        PyErr_Clear();
+        return 0;
+    }
+    bool result = false;
+    if (!detail::slot_guard([&] { result = (object->*Method)(operand.get()); }))
+    {
+        return -1;
+    }
+    return result ? 1 : 0;
+}
 
-template <typename Encoding>
-using arg_enc_cstr = ArgEncCStr<Encoding>;
+// richcmpfunc: R method(A, int op) for tp_richcompare, NotImplemented for other operands
+template <auto Method>
+inline auto richcompare_slot(PyObject* self, PyObject* other, int op) -> PyObject*
+{
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    C* object = detail::extension_object<C>(self);
+    if (!object)
+    {
+        return nullptr;
+    }
+    detail::slot_operand<detail::method_arg_t<Method, 0>> operand;
+    if (!operand.convert(other))
+    {
+        return detail::not_implemented_on_type_error();
+    }
+    return detail::slot_result<Method>(object, operand.get(), op);
+}
 
 // ╔══════════════════════════════════════════════════════════════════════════╗
-// ║ PyCXX Types                                                              ║
+// ║ PyCXX Typed Properties                                                   ║
 // ╚══════════════════════════════════════════════════════════════════════════╝
 
-namespace cxx = ::Py; // PyCXX
-
-struct TupleType
+namespace detail
 {
-    static constexpr auto parse_ptr_value() { return &PyTuple_Type; }
-};
 
-struct DictType
-{
-    static constexpr auto parse_ptr_value() { return &PyDict_Type; }
-};
+// Class of a data member or member function pointer
+template <auto Member>
+using member_class_t =
+    typename std::conditional_t<std::is_member_object_pointer_v<decltype(Member)>,
+                                member_traits<decltype(Member)>,
+                                method_traits<decltype(Member)>>::class_type;
 
-struct ListType
+// getter: data member or R method()
+template <auto Getter>
+inline auto getset_get(PyObject* self, void* /*closure*/) -> PyObject*
 {
-    static constexpr auto parse_ptr_value() { return &PyList_Type; }
-};
+    auto* object = extension_object<member_class_t<Getter>>(self);
+    if (!object)
+    {
+        return nullptr;
+    }
+    if constexpr (std::is_member_object_pointer_v<decltype(Getter)>)
+    {
+        return to_python(object->*Getter);
+    }
+    else
+    {
+        return slot_result<Getter>(object);
+    }
+}
 
-struct BytesType
+// setter: data member or void method(V)
+template <auto Setter>
+inline auto getset_set(PyObject* self, PyObject* value, void* /*closure*/) -> int
 {
-    static constexpr auto parse_ptr_value() { return &PyBytes_Type; }
-};
+    if (!value)
+    {
+        PyErr_Format(PyExc_TypeError,
+                     "cannot delete attribute of %.200s objects",
+                     Py_TYPE(self)->tp_name);
+        return -1;
+    }
+    auto* object = extension_object<member_class_t<Setter>>(self);
+    if constexpr (std::is_member_object_pointer_v<decltype(Setter)>)
+    {
+        slot_operand<typename member_traits<decltype(Setter)>::value_type> operand;
+        if (!object || !operand.convert(value))
+        {
+            return -1;
+        }
+        object->*Setter = operand.get();
+        return 0;
+    }
+    else
+    {
+        slot_operand<method_arg_t<Setter, 0>> operand;
+        if (!object || !operand.convert(value))
+        {
+            return -1;
+        }
+        return slot_guard([&] { (object->*Setter)(operand.get()); }) ? 0 : -1;
+    }
+}
 
-struct UnicodeType
+// Data members are writable by default, getter methods are read-only
+template <auto Getter>
+inline constexpr auto default_setter = [] {
+    if constexpr (std::is_member_object_pointer_v<decltype(Getter)>)
+    {
+        return Getter;
+    }
+    else
+    {
+        return nullptr;
+    }
+}();
+
+} // namespace detail
+
+/**
+ * @brief Typed attribute descriptors for PyCXX extension classes.
+ *
+ * Builds a PyGetSetDef entry for tp_getset from a data member pointer, or from a
+ * getter method and an optional setter method. Values are converted with
+ * to_python/from_python. Attribute access then goes through CPython's
+ * descriptors and type attribute cache instead of a getattro override
+ * comparing names.
+ *
+ * @code
+ * static PyGetSetDef vec_getset[] = {
+ *     getset_def<&Vec::x>("x", "X coordinate"),          // double x, read/write
+ *     getset_def<&Vec::id, nullptr>("id"),               // read-only member
+ *     getset_def<&Vec::length>("length"),                // double length() const, read-only
+ *     getset_def<&Vec::name, &Vec::set_name>("name"),    // getter and setter
+ *     getset_def_end()};
+ *
+ * behaviors().set_slot(Py_tp_getset, vec_getset);
+ * behaviors().set_slot(Py_tp_getattro, PyObject_GenericGetAttr);
+ * behaviors().set_slot(Py_tp_setattro, PyObject_GenericSetAttr);
+ * @endcode
+ *
+ * @note The table must be set before readyType(). PythonClass installs
+ *       getattro/setattro handlers by default, replace them with the generic
+ *       ones (as above) unless the class still needs its overrides.
+ */
+template <auto Getter, auto Setter = detail::default_setter<Getter>>
+constexpr auto getset_def(const char* name, const char* doc = nullptr) -> PyGetSetDef
 {
-    static constexpr auto parse_ptr_value() { return &PyUnicode_Type; }
-};
+    setter set = nullptr;
+    if constexpr (!std::is_null_pointer_v<decltype(Setter)>)
+    {
+        set = &detail::getset_set<Setter>;
+    }
+    return PyGetSetDef {name, &detail::getset_get<Getter>, set, doc, nullptr};
+}
 
-template <typename T>
-struct PyCxxArg : named_arg
+// Sentinel ending a PyGetSetDef table
+constexpr auto getset_def_end() -> PyGetSetDef
 {
-    using value_type = detail::type_list<T>;
-    using parse_type = detail::type_list<PyObject*>;
+    return PyGetSetDef {nullptr, nullptr, nullptr, nullptr, nullptr};
+}
 
-    static constexpr FmtString fmt {"O"};
-    static constexpr std::size_t offset = 1;
+// ╔══════════════════════════════════════════════════════════════════════════╗
+// ║ PyCXX Buffer Export                                                      ║
+// ╚══════════════════════════════════════════════════════════════════════════╝
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple)
+/**
+ * @brief Layout of C++ storage exported as a PEP 3118 buffer.
+ *
+ * N-dimensional view of items of arithmetic type T, with strides in bytes. Const T
+ * makes the buffer read-only. Strided views expose columns of interleaved data
+ * without copying, e.g. the y values of a vector of points:
+ *
+ * @code
+ * Buffer<double, 2> {&points[0].x, {n, 3}};                                  // n x 3, C order
+ * Buffer<const double> {&points[0].y, {n}, {sizeof(Point)}};                 // y column
+ * Buffer<float> {samples};                                                   // vector/array/span
+ * @endcode
+ */
+template <typename T, std::size_t N = 1>
+struct Buffer
+{
+    static_assert(std::is_arithmetic_v<std::remove_const_t<T>>,
+                  "Buffer items must be of arithmetic type");
+
+    T* data;
+    std::array<Py_ssize_t, N> shape;
+    std::array<Py_ssize_t, N> strides;
+
+    // C-contiguous layout
+    constexpr Buffer(T* data, const std::array<Py_ssize_t, N>& shape)
+        : data {data}
+        , shape {shape}
+        , strides {}
     {
-        std::get<Offset>(tuple) = nullptr;
+        Py_ssize_t stride = sizeof(T);
+        for (std::size_t i = N; i-- > 0;)
+        {
+            strides[i] = stride;
+            stride *= shape[i];
+        }
     }
 
-    template <std::size_t Offset, typename... Args>
-    static auto get(std::tuple<Args...>& tuple) -> T
+    constexpr Buffer(T* data,
+                     const std::array<Py_ssize_t, N>& shape,
+                     const std::array<Py_ssize_t, N>& strides)
+        : data {data}
+        , shape {shape}
+        , strides {strides}
+    {}
+
+    // Contiguous range (std::vector, std::array, std::span, ...)
+    template <std::ranges::contiguous_range R>
+        requires(N == 1)
+    constexpr explicit Buffer(R&& range)
+        : Buffer(std::ranges::data(range), {static_cast<Py_ssize_t>(std::ranges::size(range))})
+    {}
+
+    constexpr auto c_contiguous() const -> bool
     {
-        auto* ptr = static_cast<PyObject*>(std::get<Offset>(tuple));
-        return T {ptr};
+        Py_ssize_t stride = sizeof(T);
+        for (std::size_t i = N; i-- > 0;)
+        {
+            if (shape[i] > 1 && strides[i] != stride)
+            {
+                return false;
+            }
+            stride *= shape[i];
+        }
+        return true;
     }
 };
 
-template <typename T, typename PyType>
-struct PyCxxExtArg : named_arg
-{
-    using value_type = detail::type_list<T>;
-    using parse_type = detail::type_list<PyType, PyObject*>;
+template <std::ranges::contiguous_range R>
+Buffer(R&&) -> Buffer<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
 
-    static constexpr FmtString fmt {"O!"};
-    static constexpr std::size_t offset = 2;
+namespace detail
+{
 
-    template <std::size_t Offset, typename... Args>
-    static constexpr void init(std::tuple<Args...>& tuple)
+// struct module format of a native arithmetic item
+template <typename T>
+constexpr auto buffer_format() -> const char*
+{
+    if constexpr (std::is_same_v<T, bool>)
     {
-        std::get<Offset>(tuple) = PyType {};
-        std::get<Offset + 1>(tuple) = nullptr;
+        return "?";
     }
-
-    template <std::size_t Offset, typename... Args>
-    static auto get(std::tuple<Args...>& tuple) -> T
+    else if constexpr (std::is_floating_point_v<T>)
     {
-        auto* ptr = static_cast<PyObject*>(std::get<Offset + 1>(tuple));
-        return T {ptr};
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported floating point type");
+        return sizeof(T) == 4 ? "f" : "d";
     }
-};
+    else
+    {
+        constexpr const char* formats[2][4] = {{"B", "H", "I", "Q"}, {"b", "h", "i", "q"}};
+        constexpr std::size_t size = std::bit_width(sizeof(T)) - 1;
+        static_assert(size < 4 && sizeof(T) == std::size_t {1} << size, "Unsupported integer type");
+        return formats[std::is_signed_v<T> ? 1 : 0][size];
+    }
+}
 
-template <>
-struct Arg<cxx::Object> : PyCxxArg<cxx::Object>
-{};
+template <typename T>
+inline constexpr bool is_buffer_v = false;
 
-template <>
-struct Arg<cxx::Tuple> : PyCxxExtArg<cxx::Tuple, TupleType>
-{};
+template <typename T, std::size_t N>
+inline constexpr bool is_buffer_v<Buffer<T, N>> = true;
 
-template <>
-struct Arg<cxx::Dict> : PyCxxExtArg<cxx::Dict, DictType>
-{};
+inline auto buffer_error(Py_buffer* view, const char* message) -> int
+{
+    PyErr_SetString(PyExc_BufferError, message);
+    view->obj = nullptr;
+    return -1;
+}
 
-template <>
-struct Arg<cxx::List> : PyCxxExtArg<cxx::List, ListType>
-{};
+} // namespace detail
 
-template <>
-struct Arg<cxx::Callable> : PyCxxArg<cxx::Callable>
+/**
+ * @brief Fills view with the layout of buffer, exported by owner.
+ *
+ * The view keeps a reference to owner, which must keep the storage alive and
+ * in place (no reallocation) while views are exported. The shape and strides
+ * are copied to a small block owned by the view, freed by release_buffer.
+ *
+ * @return 0 on success, -1 with BufferError set if flags cannot be honoured.
+ */
+template <typename T, std::size_t N>
+inline auto fill_buffer(Py_buffer* view, PyObject* owner, const Buffer<T, N>& buffer, int flags)
+    -> int
 {
-    // Note: Callable will match any PyObject in parse phase.
-};
+    constexpr bool readonly = std::is_const_v<T>;
+    if (readonly && (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE)
+    {
+        return detail::buffer_error(view, "buffer is read-only");
+    }
+    // Strided layouts need a consumer that takes strides and asks for no contiguity
+    constexpr int contiguity_bits =
+        (PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS) & ~PyBUF_STRIDES;
+    bool contiguous = buffer.c_contiguous();
+    if (!contiguous
+        && ((flags & PyBUF_STRIDES) != PyBUF_STRIDES || (flags & contiguity_bits) != 0))
+    {
+        return detail::buffer_error(view, "buffer is not contiguous");
+    }
+    if (N > 1 && (flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS)
+    {
+        return detail::buffer_error(view, "buffer is not Fortran contiguous");
+    }
 
-template <>
-struct Arg<cxx::Bytes> : PyCxxExtArg<cxx::Bytes, BytesType>
-{};
+    auto* layout = static_cast<Py_ssize_t*>(PyMem_Malloc(2 * N * sizeof(Py_ssize_t)));
+    if (!layout)
+    {
+        PyErr_NoMemory();
+        view->obj = nullptr;
+        return -1;
+    }
+    Py_ssize_t items = 1;
+    for (std::size_t i = 0; i < N; i++)
+    {
+        layout[i] = buffer.shape[i];
+        layout[N + i] = buffer.strides[i];
+        items *= buffer.shape[i];
+    }
 
-template <>
-struct Arg<cxx::String> : PyCxxExtArg<cxx::String, UnicodeType>
-{};
+    view->buf = const_cast<std::remove_const_t<T>*>(buffer.data);
+    view->obj = Py_NewRef(owner);
+    view->len = items * static_cast<Py_ssize_t>(sizeof(T));
+    view->itemsize = sizeof(T);
+    view->readonly = readonly ? 1 : 0;
+    view->ndim = static_cast<int>(N);
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT
+        ? const_cast<char*>(detail::buffer_format<std::remove_const_t<T>>())
+        : nullptr;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? layout : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? layout + N : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = layout;
+    return 0;
+}
 
-using arg_String = Arg<cxx::String>;
-using arg_Bytes = Arg<cxx::Bytes>;
-using arg_List = Arg<cxx::List>;
-using arg_Tuple = Arg<cxx::Tuple>;
-using arg_Dict = Arg<cxx::Dict>;
-using arg_Callable = Arg<cxx::Callable>;
-using arg_Object = Arg<cxx::Object>;
+// releasebufferproc for views filled by fill_buffer
+inline void release_buffer(PyObject* /*owner*/, Py_buffer* view)
+{
+    PyMem_Free(view->internal);
+    view->internal = nullptr;
+}
+
+/**
+ * @brief getbufferproc exporting the storage returned by a member function.
+ *
+ * Method returns a Buffer<T, N>, or a contiguous range referencing storage of
+ * the object (std::vector<T>&, std::span<T>, std::array<T, N>&, ...). Nothing is
+ * copied: consumers such as memoryview or NumPy read the object's memory.
+ *
+ * @code
+ * behaviors().set_slot(Py_bf_getbuffer, buffer_slot<&Mesh::points>);
+ * behaviors().set_slot(Py_bf_releasebuffer, release_buffer);
+ * @endcode
+ */
+template <auto Method>
+inline auto buffer_slot(PyObject* self, Py_buffer* view, int flags) -> int
+{
+    using C = typename detail::method_traits<decltype(Method)>::class_type;
+    using R = typename detail::method_traits<decltype(Method)>::result_type;
+    static_assert(detail::is_buffer_v<std::remove_cvref_t<R>> || std::ranges::borrowed_range<R>,
+                  "Method must return a Buffer or a range referencing the object storage");
+
+    C* object = detail::extension_object<C>(self);
+    if (!object)
+    {
+        view->obj = nullptr;
+        return -1;
+    }
+    int result = -1;
+    bool ok = detail::slot_guard([&] {
+        if constexpr (detail::is_buffer_v<std::remove_cvref_t<R>>)
+        {
+            result = fill_buffer(view, self, (object->*Method)(), flags);
+        }
+        else
+        {
+            result = fill_buffer(view, self, Buffer {(object->*Method)()}, flags);
+        }
+    });
+    if (!ok)
+    {
+        view->obj = nullptr;
+    }
+    return result;
+}
 
 } // namespace Base::PyArgs
 
@@ -210,7 +210,7 @@ TEST_F(PyArgParserTest, BooleanArgument)
 {
     arg_int flag {"flag"};
 
-    PyObject* py_args = createTuple({Py_True});
+    PyObject* py_args = createTuple({Py_NewRef(Py_True)});
     PyObject* py_kwargs = PyDict_New();
 
     bool result = parse(py_args, py_kwargs, flag);
@@ -605,8 +605,8 @@ TEST_F(PyArgParserTest, ComplexArgumentCombination)
     PyObject* py_args = createTuple({
         PyLong_FromLong(10),           // x
         PyFloat_FromDouble(20.5),      // y
-        Py_False,                      // target
-        Py_True,                       // flag
+        Py_NewRef(Py_False),           // target
+        Py_NewRef(Py_True),            // flag
         PyUnicode_FromString("hello"), // name
         PyUnicode_FromString("UX"),    // ux
         PyUnicode_FromString("/path")  // path
@@ -661,7 +661,7 @@ TEST_F(PyArgParserTest, NullAcceptingStringArgument)
     EXPECT_STREQ(text.value, "hello");
 
     // Test with None
-    PyObject* py_args2 = createTuple({Py_None});
+    PyObject* py_args2 = createTuple({Py_NewRef(Py_None)});
     arg_utf8_cstr_none text2 {"text"};
 
     bool result2 = parse(py_args2, py_kwargs, text2);
@@ -6,8 +6,16 @@
 #include "tupleobject.h"
 #include <Python.h>
 #include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ranges>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace Base::PyArgs;
 using namespace Base::PyArgs::detail;
@@ -211,7 +219,7 @@ TEST_F(PyArgumentsTest, BooleanArgument)
         received_value = flag;
     };
 
-    PyObject* py_args = createTuple({Py_True});
+    PyObject* py_args = createTuple({Py_NewRef(Py_True)});
     PyObject* py_kwargs = PyDict_New();
 
     bool result = args.match(py_args, py_kwargs, callback);
@@ -650,8 +658,8 @@ TEST_F(PyArgumentsTest, ComplexArgumentCombination)
     PyObject* py_args = createTuple({
         PyLong_FromLong(10),           // x
         PyFloat_FromDouble(20.5),      // y
-        Py_False,                      // target
-        Py_True,                       // flag
+        Py_NewRef(Py_False),           // target
+        Py_NewRef(Py_True),            // flag
         PyUnicode_FromString("hello"), // name
         PyUnicode_FromString("UX"),    // ux
         PyUnicode_FromString("/path")  // path
@@ -751,7 +759,7 @@ TEST_F(PyArgumentsTest, DispatchOverloadsMultipleSignatures)
     };
 
     // Create Python arguments that match the second signature (int, bool)
-    PyObject* py_args = createTuple({PyLong_FromLong(42), Py_True});
+    PyObject* py_args = createTuple({PyLong_FromLong(42), Py_NewRef(Py_True)});
     PyObject* py_kwargs = PyDict_New();
 
     // Call dispatch_overloads with all three argument/callback pairs
@@ -864,6 +872,1429 @@ TEST_F(PyArgumentsTest, DispatchOverloadsWithKeywords)
     Py_DECREF(py_kwargs);
 }
 
+// Test match_async resolving a concurrent future with the converted result
+TEST_F(PyArgumentsTest, MatchAsyncResult)
+{
+    constexpr Arguments args {arg_int {"x"}, arg_string {"text"}};
+
+    auto callback = [](int x, const std::string& text) { return text + std::to_string(x * 2); };
+
+    PyObject* py_args = createTuple({PyLong_FromLong(21), PyUnicode_FromString("answer=")});
+    PyObject* py_kwargs = PyDict_New();
+
+    PyObject* future = args.match_async(py_args, py_kwargs, callback);
+    ASSERT_NE(future, nullptr);
+
+    // Future.result() releases the GIL while waiting for the worker
+    PyObject* value = PyObject_CallMethod(future, "result", "d", 5.0);
+    ASSERT_NE(value, nullptr);
+    EXPECT_STREQ(PyUnicode_AsUTF8(value), "answer=42");
+
+    Py_DECREF(value);
+    Py_DECREF(future);
+    Py_DECREF(py_args);
+    Py_DECREF(py_kwargs);
+}
+
+// Test match_async runs on a bounded set of threads by default
+TEST_F(PyArgumentsTest, MatchAsyncPool)
+{
+    constexpr Arguments args {arg_int {"x"}};
+
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    auto callback = [&](int x) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> guard {mutex};
+        threads.insert(std::this_thread::get_id());
+        return x;
+    };
+
+    const std::size_t pool_size = thread_pool::shared().size();
+    PyObject* py_args = createTuple({PyLong_FromLong(1)});
+    std::vector<PyObject*> futures;
+    for (std::size_t i = 0; i < pool_size * 4; i++)
+    {
+        futures.push_back(args.match_async(py_args, nullptr, callback));
+        ASSERT_NE(futures.back(), nullptr);
+    }
+
+    // Tasks beyond the pool size are queued, not given threads of their own
+    for (PyObject* future : futures)
+    {
+        PyObject* value = PyObject_CallMethod(future, "result", "d", 5.0);
+        ASSERT_NE(value, nullptr);
+        Py_DECREF(value);
+        Py_DECREF(future);
+    }
+    EXPECT_LE(threads.size(), pool_size);
+    EXPECT_EQ(threads.count(std::this_thread::get_id()), 0u);
+
+    Py_DECREF(py_args);
+}
+
+// Test match_async awaited from a running asyncio loop
+TEST_F(PyArgumentsTest, MatchAsyncAwaitable)
+{
+    static constexpr Arguments args {arg_int {"x"}};
+
+    static PyMethodDef method {
+        "square",
+        [](PyObject*, PyObject* py_args) -> PyObject* {
+            return args.match_async(py_args, nullptr, [](int x) { return x * x; });
+        },
+        METH_VARARGS,
+        nullptr};
+
+    PyObject* func = PyCFunction_New(&method, nullptr);
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyDict_SetItemString(globals, "square", func);
+
+    PyObject* code = PyRun_String("import asyncio\n"
+                                  "async def main():\n"
+                                  "    return await square(7)\n"
+                                  "value = asyncio.run(main())\n",
+                                  Py_file_input,
+                                  globals,
+                                  globals);
+    ASSERT_NE(code, nullptr);
+    Py_DECREF(code);
+
+    PyObject* value = PyDict_GetItemString(globals, "value");
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(PyLong_AsLong(value), 49);
+
+    Py_DECREF(globals);
+    Py_DECREF(func);
+}
+
+// Test match_async with parse errors and callback exceptions
+TEST_F(PyArgumentsTest, MatchAsyncErrors)
+{
+    constexpr Arguments args {arg_int {"x"}};
+
+    auto callback = [](int x) {
+        if (x < 0)
+        {
+            throw std::runtime_error("negative");
+        }
+    };
+
+    // Parse error: no future, exception set synchronously
+    PyObject* bad_args = createTuple({PyUnicode_FromString("not an int")});
+    EXPECT_EQ(args.match_async(bad_args, nullptr, callback), nullptr);
+    EXPECT_TRUE(PyErr_Occurred());
+    PyErr_Clear();
+    Py_DECREF(bad_args);
+
+    // C++ exception: reported through the future
+    PyObject* py_args = createTuple({PyLong_FromLong(-1)});
+    PyObject* future = args.match_async(py_args, nullptr, callback);
+    ASSERT_NE(future, nullptr);
+
+    PyObject* error = PyObject_CallMethod(future, "exception", "d", 5.0);
+    ASSERT_NE(error, nullptr);
+    EXPECT_TRUE(PyErr_GivenExceptionMatches(error, PyExc_RuntimeError));
+
+    // Executor failure: nothing scheduled, references released
+    auto failing = [](auto&&) { throw std::runtime_error("no threads"); };
+    Py_ssize_t refs = Py_REFCNT(py_args);
+    EXPECT_EQ(args.match_async(py_args, nullptr, callback, failing), nullptr);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_RuntimeError));
+    PyErr_Clear();
+    EXPECT_EQ(Py_REFCNT(py_args), refs);
+
+    // Values owning Python references cannot reach the callback
+    static_assert(gil_bound_v<Py::Object> && gil_bound_v<std::optional<Py::List>>);
+    static_assert(!gil_bound_v<PyObject*> && !gil_bound_v<std::string_view>);
+    static_assert(gil_bound_v<Lazy<int>> && gil_bound_v<VarKw> && gil_bound_v<PyFunction<int()>>);
+    static_assert(gil_bound_v<Py::Borrowed<Py::List>>);
+
+    Py_DECREF(error);
+    Py_DECREF(future);
+    Py_DECREF(py_args);
+}
+
+// Test typed Python callable argument
+TEST_F(PyArgumentsTest, PyFunctionArgument)
+{
+    constexpr Arguments args {Arg<PyFunction<double(double, int)>> {"f"}};
+
+    double received = 0.0;
+
+    auto callback = [&](PyFunction<double(double, int)> f) { received = f(1.5, 2); };
+
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* func = PyRun_String("lambda x, n: x * n", Py_eval_input, globals, globals);
+    ASSERT_NE(func, nullptr);
+
+    PyObject* py_args = createTuple({func});
+
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_DOUBLE_EQ(received, 3.0);
+
+    // Not callable: rejected while parsing
+    PyObject* bad_args = createTuple({PyLong_FromLong(1)});
+    EXPECT_FALSE(args.match(bad_args, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(bad_args);
+    Py_DECREF(py_args);
+    Py_DECREF(globals);
+}
+
+// Test Python errors raised by a typed callable
+TEST_F(PyArgumentsTest, PyFunctionErrors)
+{
+    constexpr Arguments args {Arg<PyFunction<int(std::string)>> {"f"}};
+
+    bool after_call = false;
+
+    auto callback = [&](PyFunction<int(std::string)> f) {
+        f("boom");
+        after_call = true;
+    };
+
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* func = PyRun_String("lambda s: int(s)", Py_eval_input, globals, globals);
+    ASSERT_NE(func, nullptr);
+
+    PyObject* py_args = createTuple({func});
+
+    // ValueError from int('boom') propagates through match
+    EXPECT_FALSE(args.match(py_args, nullptr, callback));
+    EXPECT_FALSE(after_call);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args);
+    Py_DECREF(globals);
+}
+
+// Test dispatch_overloads stops at a failed callback and keeps its error
+TEST_F(PyArgumentsTest, DispatchOverloadsCallbackError)
+{
+    constexpr Arguments args1 {arg_int {"x"}};
+    constexpr Arguments args2 {arg_object {"x"}};
+
+    bool fallback_called = false;
+
+    auto callback1 = [&](int) {
+        PyErr_SetString(PyExc_ValueError, "rejected");
+        throw PythonError {};
+    };
+    auto callback2 = [&](PyObject*) { fallback_called = true; };
+
+    PyObject* py_args = createTuple({PyLong_FromLong(1)});
+
+    // The first overload parses, so its callback error is reported, not cleared for the
+    // next overload
+    EXPECT_FALSE(dispatch_overloads(py_args, nullptr, args1, callback1, args2, callback2));
+    EXPECT_FALSE(fallback_called);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args);
+}
+
+// Test typed callables with arguments that do not convert
+TEST_F(PyArgumentsTest, PyFunctionConversionErrors)
+{
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* func = PyRun_String("lambda *a: 1", Py_eval_input, globals, globals);
+    ASSERT_NE(func, nullptr);
+
+    // Conversion stops at the first argument that fails, keeping its exception
+    PyFunction<int(std::string, std::string)> call {func};
+    EXPECT_THROW(call("\xff", "\xfe"), PythonError);
+    ASSERT_TRUE(PyErr_ExceptionMatches(PyExc_UnicodeDecodeError));
+    PyObject* type = nullptr;
+    PyObject* value = nullptr;
+    PyObject* traceback = nullptr;
+    PyErr_Fetch(&type, &value, &traceback);
+    PyErr_NormalizeException(&type, &value, &traceback);
+    PyObject* source = PyUnicodeDecodeError_GetObject(value);
+    ASSERT_NE(source, nullptr);
+    EXPECT_EQ(std::string(PyBytes_AS_STRING(source), PyBytes_GET_SIZE(source)), "\xff");
+    Py_DECREF(source);
+    Py_XDECREF(type);
+    Py_XDECREF(value);
+    Py_XDECREF(traceback);
+
+    Py_DECREF(func);
+    Py_DECREF(globals);
+}
+
+// Test *args captured as a borrowed span of objects
+TEST_F(PyArgumentsTest, VarArgsObjects)
+{
+    constexpr Arguments args {arg_int {"x"}, Arg<VarArgs<PyObject*>> {}};
+
+    int received_x = 0;
+    std::vector<PyObject*> received_items;
+
+    auto callback = [&](int x, VarArgs<PyObject*> rest) {
+        received_x = x;
+        received_items.assign(rest.begin(), rest.end());
+    };
+
+    PyObject* a = PyUnicode_FromString("a");
+    PyObject* b = PyUnicode_FromString("b");
+    PyObject* py_args = createTuple({PyLong_FromLong(1), a, b});
+
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(received_x, 1);
+    ASSERT_EQ(received_items.size(), 2u);
+    EXPECT_EQ(received_items[0], a); // Same objects, no copies
+    EXPECT_EQ(received_items[1], b);
+
+    // No extra arguments, x by keyword
+    PyObject* empty = PyTuple_New(0);
+    PyObject* py_kwargs = createDict({{"x", PyLong_FromLong(5)}});
+    EXPECT_TRUE(args.match(empty, py_kwargs, callback));
+    EXPECT_EQ(received_x, 5);
+    EXPECT_TRUE(received_items.empty());
+
+    Py_DECREF(py_kwargs);
+    Py_DECREF(empty);
+    Py_DECREF(py_args);
+}
+
+// Test the declared head parsed in place when *args captures items
+TEST_F(PyArgumentsTest, VarArgsHeadInPlace)
+{
+    constexpr Arguments args {arg_int {"x"},
+                              Arg<VarArgs<PyObject*>> {},
+                              arg_optionals {},
+                              arg_kw_only {},
+                              arg_int {"k", 0}};
+
+    int received_x = 0;
+    int received_k = 0;
+    std::size_t received_count = 0;
+    auto callback = [&](int x, VarArgs<PyObject*> rest, int k) {
+        received_x = x;
+        received_k = k;
+        received_count = rest.size();
+    };
+
+    // __index__ records the references to the head item while it is converted
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* run = PyRun_String("import sys\n"
+                                 "refs = []\n"
+                                 "class Probe:\n"
+                                 "    def __index__(self):\n"
+                                 "        refs.append(sys.getrefcount(self))\n"
+                                 "        return 3\n"
+                                 "probe = Probe()\n",
+                                 Py_file_input,
+                                 globals,
+                                 globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    PyObject* probe = PyDict_GetItemString(globals, "probe");
+    PyObject* refs = PyDict_GetItemString(globals, "refs");
+
+    // With extras the head is converted from the tuple items: no slice refers to it while
+    // __index__ runs, so it sees the references of a plain conversion
+    PyObject* py_args = createTuple({Py_NewRef(probe), PyLong_FromLong(1), PyLong_FromLong(2)});
+    PyObject* py_kwargs = createDict({{"k", PyLong_FromLong(5)}});
+    Py_XDECREF(PyNumber_Index(probe));
+    EXPECT_TRUE(args.match(py_args, py_kwargs, callback));
+    EXPECT_EQ(received_x, 3);
+    EXPECT_EQ(received_k, 5);
+    EXPECT_EQ(received_count, 2u);
+    ASSERT_EQ(PyList_GET_SIZE(refs), 2);
+    EXPECT_EQ(PyLong_AsLong(PyList_GET_ITEM(refs, 1)), PyLong_AsLong(PyList_GET_ITEM(refs, 0)));
+
+    // Keyword errors are still reported
+    PyObject* dup_kwargs = createDict({{"x", PyLong_FromLong(1)}});
+    EXPECT_FALSE(args.match(py_args, dup_kwargs, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    PyObject* bad_kwargs = createDict({{"z", PyLong_FromLong(1)}});
+    EXPECT_FALSE(args.match(py_args, bad_kwargs, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(bad_kwargs);
+    Py_DECREF(dup_kwargs);
+    Py_DECREF(py_kwargs);
+    Py_DECREF(py_args);
+    Py_DECREF(globals);
+}
+
+// Test *args converted to a typed small buffer
+TEST_F(PyArgumentsTest, VarArgsTyped)
+{
+    constexpr Arguments args {arg_string {"op"}, Arg<VarArgs<double, 2>> {}};
+
+    std::string received_op;
+    double sum = 0.0;
+    std::size_t count = 0;
+
+    auto callback = [&](const std::string& op, VarArgs<double, 2> values) {
+        received_op = op;
+        count = values.size();
+        sum = 0.0;
+        for (double value : values)
+        {
+            sum += value;
+        }
+    };
+
+    // More items than the inline capacity
+    PyObject* py_args = createTuple({PyUnicode_FromString("sum"),
+                                     PyFloat_FromDouble(1.5),
+                                     PyLong_FromLong(2),
+                                     PyFloat_FromDouble(3.5)});
+
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(received_op, "sum");
+    EXPECT_EQ(count, 3u);
+    EXPECT_DOUBLE_EQ(sum, 7.0);
+
+    // Conversion errors are parse errors
+    PyObject* bad_args = createTuple({PyUnicode_FromString("sum"), PyUnicode_FromString("x")});
+    EXPECT_FALSE(args.match(bad_args, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(bad_args);
+    Py_DECREF(py_args);
+}
+
+// Test **kwargs captured as a borrowed view
+TEST_F(PyArgumentsTest, VarKwCapture)
+{
+    constexpr Arguments args {arg_int {"x"}, arg_optionals {}, arg_int {"y", 7}, Arg<VarKw> {}};
+
+    int received_x = 0;
+    int received_y = 0;
+    std::vector<std::string> extra_keys;
+    PyObject* extra_a = nullptr;
+    PyObject* forwarded = nullptr;
+
+    auto callback = [&](int x, int y, VarKw extra) {
+        received_x = x;
+        received_y = y;
+        extra_keys.clear();
+        for (const auto& [key, value] : extra)
+        {
+            extra_keys.emplace_back(PyUnicode_AsUTF8(key));
+        }
+        extra_a = extra.get("a");
+        EXPECT_EQ(extra.get("x"), nullptr); // Declared keywords are not part of the view
+        Py_XDECREF(forwarded);
+        forwarded = extra.to_dict();
+    };
+
+    PyObject* one = PyLong_FromLong(1);
+    PyObject* py_args = PyTuple_New(0);
+    PyObject* py_kwargs = createDict({
+        {"a", one                },
+        {"x", PyLong_FromLong(3) },
+        {"b", PyLong_FromLong(2) }
+    });
+
+    EXPECT_TRUE(args.match(py_args, py_kwargs, callback));
+    EXPECT_EQ(received_x, 3);
+    EXPECT_EQ(received_y, 7);
+    EXPECT_EQ(extra_keys, (std::vector<std::string> {"a", "b"}));
+    EXPECT_EQ(extra_a, one);
+    ASSERT_NE(forwarded, nullptr);
+    EXPECT_EQ(PyDict_Size(forwarded), 2);
+
+    // No extra keywords
+    PyObject* py_args2 = createTuple({PyLong_FromLong(4)});
+    EXPECT_TRUE(args.match(py_args2, nullptr, callback));
+    EXPECT_EQ(received_x, 4);
+    EXPECT_TRUE(extra_keys.empty());
+    EXPECT_EQ(PyDict_Size(forwarded), 0);
+
+    // Extra positional arguments are still rejected without *args
+    received_x = 0;
+    PyObject* py_args3 = createTuple({PyLong_FromLong(1), PyLong_FromLong(2), PyLong_FromLong(3)});
+    EXPECT_FALSE(args.match(py_args3, nullptr, callback));
+    EXPECT_EQ(received_x, 0);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_XDECREF(forwarded);
+    Py_DECREF(py_args3);
+    Py_DECREF(py_args2);
+    Py_DECREF(py_kwargs);
+    Py_DECREF(py_args);
+}
+
+// Test declared keywords converted from the keyword dict in place
+TEST_F(PyArgumentsTest, VarKwInPlace)
+{
+    constexpr Arguments args {arg_int {"x"}, Arg<VarKw> {}};
+
+    int received_x = 0;
+    std::size_t received_count = 0;
+    auto callback = [&](int x, VarKw extra) {
+        received_x = x;
+        received_count = extra.size();
+    };
+
+    // __index__ records the references to the declared value while it is converted
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* run = PyRun_String("import sys\n"
+                                 "refs = []\n"
+                                 "class Probe:\n"
+                                 "    def __index__(self):\n"
+                                 "        refs.append(sys.getrefcount(self))\n"
+                                 "        return 3\n"
+                                 "probe = Probe()\n",
+                                 Py_file_input,
+                                 globals,
+                                 globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    PyObject* probe = PyDict_GetItemString(globals, "probe");
+    PyObject* refs = PyDict_GetItemString(globals, "refs");
+
+    // No filtered dict of the declared keywords refers to the value
+    PyObject* py_args = PyTuple_New(0);
+    PyObject* py_kwargs = createDict({
+        {"x",     Py_NewRef(probe)  },
+        {"other", PyLong_FromLong(1)}
+    });
+    Py_XDECREF(PyNumber_Index(probe));
+    EXPECT_TRUE(args.match(py_args, py_kwargs, callback));
+    EXPECT_EQ(received_x, 3);
+    EXPECT_EQ(received_count, 1u);
+    ASSERT_EQ(PyList_GET_SIZE(refs), 2);
+    EXPECT_EQ(PyLong_AsLong(PyList_GET_ITEM(refs, 1)), PyLong_AsLong(PyList_GET_ITEM(refs, 0)));
+
+    Py_DECREF(py_kwargs);
+    Py_DECREF(py_args);
+    Py_DECREF(globals);
+}
+
+// Test std::optional arguments (T or None)
+TEST_F(PyArgumentsTest, OptionalValueArguments)
+{
+    constexpr Arguments args {Arg<std::optional<int>> {"count"},
+                              Arg<std::optional<std::string_view>> {"label"},
+                              arg_optionals {},
+                              Arg<std::optional<double>> {"scale", 2.0}};
+
+    std::optional<int> received_count;
+    std::optional<std::string_view> received_label;
+    std::optional<double> received_scale;
+
+    auto callback = [&](std::optional<int> count,
+                        std::optional<std::string_view> label,
+                        std::optional<double> scale) {
+        received_count = count;
+        received_label = label;
+        received_scale = scale;
+    };
+
+    // Values
+    PyObject* py_args = createTuple(
+        {PyLong_FromLong(3), PyUnicode_FromString("name"), PyFloat_FromDouble(0.5)});
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(received_count, 3);
+    EXPECT_EQ(received_label, "name");
+    EXPECT_EQ(received_scale, 0.5);
+
+    // None and default
+    PyObject* py_args2 = createTuple({Py_NewRef(Py_None), Py_NewRef(Py_None)});
+    EXPECT_TRUE(args.match(py_args2, nullptr, callback));
+    EXPECT_FALSE(received_count.has_value());
+    EXPECT_FALSE(received_label.has_value());
+    EXPECT_EQ(received_scale, 2.0);
+
+    // Wrong type is still an error
+    PyObject* py_args3 = createTuple({PyUnicode_FromString("3"), Py_NewRef(Py_None)});
+    EXPECT_FALSE(args.match(py_args3, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args3);
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+}
+
+// Test std::optional of marker arguments (Bool, SSize, Byte1, Char1, NNByte, FSPath)
+TEST_F(PyArgumentsTest, OptionalMarkerArguments)
+{
+    constexpr Arguments args {Arg<std::optional<Bool>> {"flag"},
+                              Arg<std::optional<SSize>> {"size"},
+                              Arg<std::optional<Byte1>> {"byte"},
+                              Arg<std::optional<Char1>> {"chr"},
+                              Arg<std::optional<NNByte>> {"small"},
+                              Arg<std::optional<FSPath>> {"path"}};
+
+    std::optional<int> received_flag;
+    std::optional<Py_ssize_t> received_size;
+    std::optional<char> received_byte;
+    std::optional<int> received_chr;
+    std::optional<unsigned char> received_small;
+    std::optional<std::string> received_path;
+
+    auto callback = [&](std::optional<int> flag,
+                        std::optional<Py_ssize_t> size,
+                        std::optional<char> byte,
+                        std::optional<int> chr,
+                        std::optional<unsigned char> small,
+                        std::optional<std::string_view> path) {
+        received_flag = flag;
+        received_size = size;
+        received_byte = byte;
+        received_chr = chr;
+        received_small = small;
+        received_path = path ? std::optional<std::string> {*path} : std::nullopt;
+    };
+
+    PyObject* py_args = createTuple({PyList_New(0),
+                                     PyLong_FromSsize_t(PY_SSIZE_T_MAX),
+                                     PyBytes_FromString("b"),
+                                     PyUnicode_FromString("\xc3\xa9"),
+                                     PyLong_FromLong(200),
+                                     PyUnicode_FromString("/tmp/x")});
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(received_flag, 0);
+    EXPECT_EQ(received_size, PY_SSIZE_T_MAX);
+    EXPECT_EQ(received_byte, 'b');
+    EXPECT_EQ(received_chr, 0xe9);
+    EXPECT_EQ(received_small, 200);
+    EXPECT_EQ(received_path, "/tmp/x");
+
+    PyObject* py_args2 = createTuple({Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None)});
+    EXPECT_TRUE(args.match(py_args2, nullptr, callback));
+    EXPECT_FALSE(received_flag.has_value());
+    EXPECT_FALSE(received_size.has_value());
+    EXPECT_FALSE(received_byte.has_value());
+    EXPECT_FALSE(received_chr.has_value());
+    EXPECT_FALSE(received_small.has_value());
+    EXPECT_FALSE(received_path.has_value());
+
+    // The rules of the format units still apply to values
+    PyObject* py_args3 = createTuple({Py_NewRef(Py_True),
+                                      PyFloat_FromDouble(1.0),
+                                      Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None),
+                                      Py_NewRef(Py_None)});
+    EXPECT_FALSE(args.match(py_args3, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    PyObject* py_args4 = createTuple({Py_NewRef(Py_True),
+                                      Py_NewRef(Py_None),
+                                      PyBytes_FromString("ab"),
+                                      PyUnicode_FromString("ab"),
+                                      PyLong_FromLong(-1),
+                                      Py_NewRef(Py_None)});
+    EXPECT_FALSE(args.match(py_args4, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args4);
+    Py_DECREF(py_args3);
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+}
+
+// Test string/int to enum arguments
+TEST_F(PyArgumentsTest, EnumArgument)
+{
+    enum class Mode
+    {
+        Fast,
+        Precise,
+        Adaptive
+    };
+
+    using arg_mode = Arg<Enum<Mode, "fast", "precise", "adaptive">>;
+    constexpr Arguments args {arg_optionals {}, arg_mode {"mode", Mode::Precise}};
+
+    static_assert(arg_mode::hash::lookup("adaptive") == 2);
+    static_assert(arg_mode::hash::lookup("slow") == -1);
+
+    Mode received = Mode::Fast;
+    auto callback = [&](Mode mode) { received = mode; };
+
+    PyObject* by_name = createTuple({PyUnicode_FromString("adaptive")});
+    EXPECT_TRUE(args.match(by_name, nullptr, callback));
+    EXPECT_EQ(received, Mode::Adaptive);
+
+    PyObject* by_value = createTuple({PyLong_FromLong(0)});
+    EXPECT_TRUE(args.match(by_value, nullptr, callback));
+    EXPECT_EQ(received, Mode::Fast);
+
+    PyObject* empty = PyTuple_New(0);
+    EXPECT_TRUE(args.match(empty, nullptr, callback));
+    EXPECT_EQ(received, Mode::Precise);
+
+    // Unknown name, out of range value and wrong type
+    PyObject* bad_name = createTuple({PyUnicode_FromString("Fast")});
+    EXPECT_FALSE(args.match(bad_name, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+
+    PyObject* bad_value = createTuple({PyLong_FromLong(3)});
+    EXPECT_FALSE(args.match(bad_value, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+
+    PyObject* bad_type = createTuple({PyFloat_FromDouble(1.0)});
+    EXPECT_FALSE(args.match(bad_type, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(bad_type);
+    Py_DECREF(bad_value);
+    Py_DECREF(bad_name);
+    Py_DECREF(empty);
+    Py_DECREF(by_value);
+    Py_DECREF(by_name);
+}
+
+// Test enum arguments with explicit enumerator values
+TEST_F(PyArgumentsTest, EnumValuesArgument)
+{
+    enum class Flag : unsigned
+    {
+        Read = 1,
+        Write = 2,
+        Exec = 4
+    };
+
+    using arg_flag = Arg<EnumValues<Flag,
+                                    EnumValue<"read", Flag::Read>,
+                                    EnumValue<"write", Flag::Write>,
+                                    EnumValue<"exec", Flag::Exec>>>;
+    constexpr Arguments args {arg_optionals {}, arg_flag {"flag", Flag::Write}};
+
+    Flag received = Flag::Read;
+    auto callback = [&](Flag flag) { received = flag; };
+
+    PyObject* by_name = createTuple({PyUnicode_FromString("exec")});
+    EXPECT_TRUE(args.match(by_name, nullptr, callback));
+    EXPECT_EQ(received, Flag::Exec);
+
+    // Ints are enumerator values, not name indices
+    PyObject* by_value = createTuple({PyLong_FromLong(4)});
+    EXPECT_TRUE(args.match(by_value, nullptr, callback));
+    EXPECT_EQ(received, Flag::Exec);
+
+    PyObject* empty = PyTuple_New(0);
+    EXPECT_TRUE(args.match(empty, nullptr, callback));
+    EXPECT_EQ(received, Flag::Write);
+
+    for (long value : {0L, 3L, -1L})
+    {
+        PyObject* bad_value = createTuple({PyLong_FromLong(value)});
+        EXPECT_FALSE(args.match(bad_value, nullptr, callback));
+        EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+        PyErr_Clear();
+        Py_DECREF(bad_value);
+    }
+
+    Py_DECREF(empty);
+    Py_DECREF(by_value);
+    Py_DECREF(by_name);
+}
+
+// Test value converters (exact builtins and generic protocol fallbacks)
+TEST_F(PyArgumentsTest, NumericConverters)
+{
+    int int_value = 0;
+    unsigned char byte_value = 0;
+    double double_value = 0.0;
+    bool bool_value = false;
+
+    // Exact builtins
+    PyObject* small = PyLong_FromLong(-42);
+    PyObject* number = PyFloat_FromDouble(2.5);
+    EXPECT_TRUE(from_python(small, int_value));
+    EXPECT_EQ(int_value, -42);
+    EXPECT_TRUE(from_python(number, double_value));
+    EXPECT_DOUBLE_EQ(double_value, 2.5);
+    EXPECT_TRUE(from_python(Py_True, bool_value));
+    EXPECT_TRUE(bool_value);
+    EXPECT_TRUE(from_python(Py_False, bool_value));
+    EXPECT_FALSE(bool_value);
+
+    // Fallbacks: bool is an int subclass, int converts to double, truthiness of objects
+    EXPECT_TRUE(from_python(Py_True, int_value));
+    EXPECT_EQ(int_value, 1);
+    EXPECT_TRUE(from_python(small, double_value));
+    EXPECT_DOUBLE_EQ(double_value, -42.0);
+    EXPECT_TRUE(from_python(number, bool_value));
+    EXPECT_TRUE(bool_value);
+
+    // Range checks
+    PyObject* big = PyLong_FromLongLong(1LL << 40);
+    PyObject* huge = PyLong_FromString("123456789012345678901234567890", nullptr, 10);
+    EXPECT_FALSE(from_python(big, int_value));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_OverflowError));
+    PyErr_Clear();
+    EXPECT_FALSE(from_python(huge, int_value));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_OverflowError));
+    PyErr_Clear();
+    EXPECT_FALSE(from_python(small, byte_value));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_OverflowError));
+    PyErr_Clear();
+
+    // float is not an integer
+    EXPECT_FALSE(from_python(number, int_value));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(huge);
+    Py_DECREF(big);
+    Py_DECREF(number);
+    Py_DECREF(small);
+}
+
+// Test tuple/dict arguments with the exact-type and subclass checks
+TEST_F(PyArgumentsTest, TypedObjectArguments)
+{
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* run = PyRun_String("class T(tuple): pass\nvalue = T((1, 2))\n",
+                                 Py_file_input,
+                                 globals,
+                                 globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    PyObject* subclass = PyDict_GetItemString(globals, "value");
+
+    constexpr Arguments args {Arg<Tuple> {"data"}, Arg<Dict> {"options"}};
+    constexpr Arguments exact {Arg<Exact<Tuple>> {"data"}};
+
+    PyTupleObject* received_data = nullptr;
+    PyDictObject* received_options = nullptr;
+    auto callback = [&](PyTupleObject* data, PyDictObject* options) {
+        received_data = data;
+        received_options = options;
+    };
+    auto exact_callback = [&](PyTupleObject* data) { received_data = data; };
+
+    // Exact types
+    PyObject* tuple = createTuple({PyLong_FromLong(1)});
+    PyObject* py_args = createTuple({Py_NewRef(tuple), PyDict_New()});
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(reinterpret_cast<PyObject*>(received_data), tuple);
+    EXPECT_NE(received_options, nullptr);
+
+    // Subclasses are accepted by default, rejected in exact mode
+    PyObject* py_args2 = createTuple({Py_NewRef(subclass), PyDict_New()});
+    EXPECT_TRUE(args.match(py_args2, nullptr, callback));
+    EXPECT_EQ(reinterpret_cast<PyObject*>(received_data), subclass);
+
+    PyObject* py_args3 = createTuple({Py_NewRef(tuple)});
+    EXPECT_TRUE(exact.match(py_args3, nullptr, exact_callback));
+
+    PyObject* py_args4 = createTuple({Py_NewRef(subclass)});
+    EXPECT_FALSE(exact.match(py_args4, nullptr, exact_callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    // Wrong type
+    PyObject* py_args5 = createTuple({PyList_New(0), PyDict_New()});
+    EXPECT_FALSE(args.match(py_args5, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args5);
+    Py_DECREF(py_args4);
+    Py_DECREF(py_args3);
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+    Py_DECREF(tuple);
+    Py_DECREF(globals);
+}
+
+// Test ranges and generators converted to lazy Python iterators
+TEST_F(PyArgumentsTest, LazyRangeIterators)
+{
+    auto list_of = [](PyObject* iterator) {
+        std::vector<long> values;
+        while (PyObject* item = PyIter_Next(iterator))
+        {
+            values.push_back(PyLong_AsLong(item));
+            Py_DECREF(item);
+        }
+        Py_DECREF(iterator);
+        return values;
+    };
+
+    // Containers and borrowed views are copied to lists
+    std::vector<int> numbers {1, 2, 3};
+    PyObject* list = to_python(numbers);
+    ASSERT_TRUE(PyList_Check(list));
+    EXPECT_EQ(list_of(PyObject_GetIter(list)), (std::vector<long> {1, 2, 3}));
+    Py_DECREF(list);
+    list = to_python(std::span<const int> {numbers});
+    ASSERT_TRUE(PyList_Check(list));
+    EXPECT_EQ(PyList_GET_SIZE(list), 3);
+    Py_DECREF(list);
+
+    // Owning views moved in are iterated lazily
+    auto square = [](int i) { return i * i; };
+    PyObject* squares = to_python(std::views::iota(0, 5) | std::views::transform(square));
+    ASSERT_FALSE(PyList_Check(squares));
+    EXPECT_EQ(list_of(squares), (std::vector<long> {0, 1, 4, 9, 16}));
+
+    // Generator body runs on demand
+    int produced = 0;
+    auto generate = [&produced](int count) -> Generator<int> {
+        for (int i = 0; i < count; i++)
+        {
+            produced++;
+            co_yield i * 10;
+        }
+    };
+    PyObject* iterator = to_python(generate(1000000));
+    ASSERT_NE(iterator, nullptr);
+    EXPECT_EQ(produced, 0);
+    EXPECT_EQ(PyObject_GetIter(iterator), iterator);
+    Py_DECREF(iterator);
+
+    PyObject* item = PyIter_Next(iterator);
+    EXPECT_EQ(PyLong_AsLong(item), 0);
+    Py_DECREF(item);
+    item = PyIter_Next(iterator);
+    EXPECT_EQ(PyLong_AsLong(item), 10);
+    Py_DECREF(item);
+    EXPECT_EQ(produced, 2);
+    Py_DECREF(iterator); // destroys the suspended coroutine
+
+    EXPECT_EQ(list_of(to_python(generate(3))), (std::vector<long> {0, 10, 20}));
+    EXPECT_EQ(list_of(to_python(generate(0))), (std::vector<long> {}));
+    EXPECT_FALSE(PyErr_Occurred());
+
+    // Exceptions in the body surface as RuntimeError and end the iteration
+    auto failing = []() -> Generator<std::string> {
+        co_yield "first";
+        throw std::runtime_error("broken generator");
+    };
+    iterator = to_python(failing());
+    item = PyIter_Next(iterator);
+    EXPECT_STREQ(PyUnicode_AsUTF8(item), "first");
+    Py_DECREF(item);
+    EXPECT_EQ(PyIter_Next(iterator), nullptr);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_RuntimeError));
+    PyErr_Clear();
+    EXPECT_EQ(PyIter_Next(iterator), nullptr);
+    EXPECT_FALSE(PyErr_Occurred());
+    Py_DECREF(iterator);
+
+    // So do exceptions not derived from std::exception
+    auto throwing = [](int i) {
+        if (i == 1)
+        {
+            throw 42;
+        }
+        return i;
+    };
+    iterator = to_python(std::views::iota(0, 3) | std::views::transform(throwing));
+    item = PyIter_Next(iterator);
+    EXPECT_EQ(PyLong_AsLong(item), 0);
+    Py_DECREF(item);
+    EXPECT_EQ(PyIter_Next(iterator), nullptr);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_RuntimeError));
+    PyErr_Clear();
+    EXPECT_EQ(PyIter_Next(iterator), nullptr);
+    EXPECT_FALSE(PyErr_Occurred());
+    Py_DECREF(iterator);
+}
+
+// Test bytes/str results written in place
+TEST_F(PyArgumentsTest, OutputBuilders)
+{
+    // Growing past the size hint, then shrunk to the written size
+    BytesBuilder bytes {4};
+    bytes.append("hello");
+    bytes.push_back(' ');
+    std::copy_n("world", 5, bytes.grow(5));
+    EXPECT_EQ(bytes.size(), 11);
+    PyObject* result = bytes.release();
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(std::string(PyBytes_AS_STRING(result), PyBytes_GET_SIZE(result)), "hello world");
+    Py_DECREF(result);
+    EXPECT_EQ(bytes.release(), nullptr);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_RuntimeError));
+    PyErr_Clear();
+
+    // Written up to the hint, then cut down
+    BytesBuilder exact {16};
+    exact.resize(16);
+    std::fill_n(exact.data(), 16, 'x');
+    exact.resize(3);
+    result = to_python(std::move(exact));
+    EXPECT_EQ(PyBytes_GET_SIZE(result), 3);
+    Py_DECREF(result);
+
+    result = BytesBuilder {}.release();
+    EXPECT_EQ(PyBytes_GET_SIZE(result), 0);
+    Py_DECREF(result);
+
+    // ASCII text keeps the 1 byte kind it was written to
+    StringBuilder text {2};
+    text.append("ascii ");
+    text.append("text");
+    result = text.release();
+    ASSERT_NE(result, nullptr);
+    EXPECT_TRUE(PyUnicode_IS_ASCII(result));
+    EXPECT_STREQ(PyUnicode_AsUTF8(result), "ascii text");
+    Py_DECREF(result);
+
+    // Other UTF-8 text is decoded to the narrowest kind
+    StringBuilder utf8;
+    utf8.append("caf\xc3\xa9 \xe2\x82\xac");
+    result = to_python(std::move(utf8));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(PyUnicode_GET_LENGTH(result), 6);
+    EXPECT_EQ(PyUnicode_KIND(result), PyUnicode_2BYTE_KIND);
+    EXPECT_STREQ(PyUnicode_AsUTF8(result), "caf\xc3\xa9 \xe2\x82\xac");
+    Py_DECREF(result);
+
+    StringBuilder invalid;
+    invalid.append("bad \xff");
+    EXPECT_EQ(invalid.release(), nullptr);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_UnicodeDecodeError));
+    PyErr_Clear();
+}
+
+// Test arguments type checked while parsing and converted on first read
+TEST_F(PyArgumentsTest, LazyArguments)
+{
+    constexpr Arguments args {arg_bool {"use"}, Arg<Lazy<std::vector<int>>> {"values"}};
+    constexpr Arguments text {Arg<Lazy<std::string>> {"name"}};
+    constexpr Arguments optional {arg_optionals {}, Arg<Lazy<double>> {"scale"}};
+
+    int sum = 0;
+    const std::vector<int>* first = nullptr;
+    const std::vector<int>* second = nullptr;
+    auto callback = [&](int use, Lazy<std::vector<int>> values) {
+        if (!use)
+        {
+            return;
+        }
+        first = &values.value();
+        second = &*values;
+        for (int v : *values)
+        {
+            sum += v;
+        }
+    };
+
+    // The bad item is only seen when the callback reads the value
+    auto make_args = [&](bool use) {
+        PyObject* list = PyList_New(3);
+        PyList_SET_ITEM(list, 0, PyLong_FromLong(1));
+        PyList_SET_ITEM(list, 1, PyLong_FromLong(2));
+        PyList_SET_ITEM(list, 2, PyUnicode_FromString("three"));
+        return createTuple({PyBool_FromLong(use), list});
+    };
+    PyObject* py_args = make_args(false);
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(first, nullptr);
+
+    PyObject* py_args2 = make_args(true);
+    EXPECT_FALSE(args.match(py_args2, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    // Converted once, same value on later reads
+    PyObject* py_args3 = createTuple({Py_NewRef(Py_True), Py_BuildValue("(iii)", 1, 2, 3)});
+    EXPECT_TRUE(args.match(py_args3, nullptr, callback));
+    EXPECT_EQ(sum, 6);
+    EXPECT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+
+    // The cheap check still rejects the wrong Python type while parsing
+    bool called = false;
+    auto text_callback = [&](Lazy<std::string>) { called = true; };
+    PyObject* py_args4 = createTuple({PyLong_FromLong(1)});
+    EXPECT_FALSE(text.match(py_args4, nullptr, text_callback));
+    EXPECT_FALSE(called);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    // Missing optional argument
+    bool given = true;
+    double scale = 0.0;
+    auto optional_callback = [&](Lazy<double> value) {
+        given = value.has_value();
+        scale = value.value_or(1.5);
+    };
+    PyObject* py_args5 = createTuple({});
+    EXPECT_TRUE(optional.match(py_args5, nullptr, optional_callback));
+    EXPECT_FALSE(given);
+    EXPECT_DOUBLE_EQ(scale, 1.5);
+
+    PyObject* py_args6 = createTuple({PyLong_FromLong(2)});
+    EXPECT_TRUE(optional.match(py_args6, nullptr, optional_callback));
+    EXPECT_TRUE(given);
+    EXPECT_DOUBLE_EQ(scale, 2.0);
+
+    Py_DECREF(py_args6);
+    Py_DECREF(py_args5);
+    Py_DECREF(py_args4);
+    Py_DECREF(py_args3);
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+}
+
+// Test record attributes read into typed values
+TEST_F(PyArgumentsTest, RecordFields)
+{
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* run = PyRun_String("from collections import namedtuple\n"
+                                 "from dataclasses import dataclass\n"
+                                 "Point = namedtuple('Point', 'z y x')\n"
+                                 "class Slots:\n"
+                                 "    __slots__ = ('x', 'y', 'z')\n"
+                                 "    def __init__(self, x, y, z):\n"
+                                 "        self.x, self.y, self.z = x, y, z\n"
+                                 "@dataclass\n"
+                                 "class Data:\n"
+                                 "    x: float\n"
+                                 "    y: float\n"
+                                 "    z: float\n"
+                                 "class Proxy:\n"
+                                 "    def __getattr__(self, name): return len(name)\n"
+                                 "@dataclass\n"
+                                 "class Item:\n"
+                                 "    id: int\n"
+                                 "    name: str\n"
+                                 "values = [Point(3, 2, 1), Slots(1, 2, 3), Data(1, 2, 3)]\n"
+                                 "empty = Slots.__new__(Slots)\n"
+                                 "class Other:\n"
+                                 "    __slots__ = ('v', 'w')\n"
+                                 "class Foreign:\n"
+                                 "    x, y, z = Other.w, 2.0, 3.0\n"
+                                 "foreign = Foreign()\n",
+                                 Py_file_input,
+                                 globals,
+                                 globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+
+    constexpr Arguments args {Arg<Fields<double, "x", "y", "z">> {"point"}};
+    using item_fields = Fields<std::tuple<int, std::string>, "id", "name">;
+    constexpr Arguments item_args {Arg<item_fields> {"item"}};
+
+    std::array<double, 3> received {};
+    auto callback = [&](std::array<double, 3> point) { received = point; };
+
+    auto call = [&](PyObject* value) {
+        received = {};
+        PyObject* py_args = createTuple({Py_NewRef(value)});
+        bool ok = args.match(py_args, nullptr, callback);
+        Py_DECREF(py_args);
+        return ok;
+    };
+
+    // namedtuple, __slots__ and plain instances, twice each to go through the cache
+    PyObject* values = PyDict_GetItemString(globals, "values");
+    for (int repeat = 0; repeat < 2; ++repeat)
+    {
+        for (Py_ssize_t i = 0; i < PyList_GET_SIZE(values); ++i)
+        {
+            EXPECT_TRUE(call(PyList_GET_ITEM(values, i)));
+            EXPECT_EQ(received, (std::array<double, 3> {1.0, 2.0, 3.0}));
+        }
+        EXPECT_TRUE(call(PyList_GET_ITEM(values, 1)));
+        EXPECT_EQ(received, (std::array<double, 3> {1.0, 2.0, 3.0}));
+    }
+
+    // namedtuple fields are read by index, recognized by their descriptor type
+    PyObject* x_name = PyUnicode_FromString("x");
+    field_slot point_x = resolve_field(Py_TYPE(PyList_GET_ITEM(values, 0)), x_name);
+    EXPECT_EQ(point_x.kind, field_slot::tuple_item);
+    EXPECT_EQ(point_x.index, 2);
+    Py_DECREF(x_name);
+
+    // Changing the class invalidates the cached descriptors
+    run = PyRun_String("Slots.y = property(lambda self: 20.0)\n", Py_file_input, globals, globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    EXPECT_TRUE(call(PyList_GET_ITEM(values, 1)));
+    EXPECT_EQ(received, (std::array<double, 3> {1.0, 20.0, 3.0}));
+
+    // Custom attribute access is honored
+    run = PyRun_String("proxy = Proxy()\n", Py_file_input, globals, globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    EXPECT_TRUE(call(PyDict_GetItemString(globals, "proxy")));
+    EXPECT_EQ(received, (std::array<double, 3> {1.0, 1.0, 1.0}));
+
+    // Missing attributes and wrong field types
+    EXPECT_FALSE(call(PyDict_GetItemString(globals, "empty")));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_AttributeError));
+    PyErr_Clear();
+
+    // Slot descriptor of another class, rejected like Python does
+    EXPECT_FALSE(call(PyDict_GetItemString(globals, "foreign")));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    PyObject* text = PyUnicode_FromString("point");
+    EXPECT_FALSE(call(text));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_AttributeError));
+    PyErr_Clear();
+    Py_DECREF(text);
+
+    // Mixed field types
+    run = PyRun_String("item = Item(7, 'seven')\n", Py_file_input, globals, globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    std::tuple<int, std::string> received_item {};
+    PyObject* py_args = createTuple({Py_NewRef(PyDict_GetItemString(globals, "item"))});
+    EXPECT_TRUE(item_args.match(py_args, nullptr, [&](std::tuple<int, std::string> item) {
+        received_item = item;
+    }));
+    EXPECT_EQ(received_item, (std::tuple<int, std::string> {7, "seven"}));
+
+    Py_DECREF(py_args);
+    Py_DECREF(globals);
+}
+
+// Test dicts converted to C++ maps and aggregates
+TEST_F(PyArgumentsTest, DictConversions)
+{
+    struct Options
+    {
+        int width {640};
+        double scale {1.0};
+        std::string mode {"fast"};
+    };
+    using options_record = Record<Options,
+                                  Key<"width", &Options::width>,
+                                  Key<"scale", &Options::scale>,
+                                  Key<"mode", &Options::mode>>;
+
+    constexpr Arguments sorted {Arg<Map<std::string, int>> {"counts"}};
+    constexpr Arguments hashed {Arg<Map<int, double, std::map<int, double>>> {"weights"}};
+    constexpr Arguments record {Arg<options_record> {"options"}};
+
+    // Sorted vector of pairs
+    std::vector<std::pair<std::string, int>> counts;
+    auto sorted_callback = [&](std::vector<std::pair<std::string, int>> value) {
+        counts = std::move(value);
+    };
+    PyObject* dict = Py_BuildValue("{s:i,s:i,s:i}", "b", 2, "c", 3, "a", 1);
+    PyObject* py_args = createTuple({dict});
+    EXPECT_TRUE(sorted.match(py_args, nullptr, sorted_callback));
+    EXPECT_EQ(counts,
+              (std::vector<std::pair<std::string, int>> {{"a", 1}, {"b", 2}, {"c", 3}}));
+
+    // Other containers
+    std::map<int, double> weights;
+    auto hashed_callback = [&](std::map<int, double> value) { weights = std::move(value); };
+    PyObject* py_args2 = createTuple({Py_BuildValue("{i:d,i:i}", 2, 0.5, 1, 3)});
+    EXPECT_TRUE(hashed.match(py_args2, nullptr, hashed_callback));
+    EXPECT_EQ(weights, (std::map<int, double> {{1, 3.0}, {2, 0.5}}));
+
+    // Bad items and non dict arguments
+    PyObject* py_args3 = createTuple({Py_BuildValue("{s:s}", "a", "one")});
+    EXPECT_FALSE(sorted.match(py_args3, nullptr, sorted_callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    PyObject* py_args4 = createTuple({PyList_New(0)});
+    EXPECT_FALSE(sorted.match(py_args4, nullptr, sorted_callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    // Aggregate, missing keys keep their initializers
+    Options options;
+    auto record_callback = [&](Options value) { options = std::move(value); };
+    PyObject* py_args5 = createTuple({Py_BuildValue("{s:i,s:s}", "width", 800, "mode", "precise")});
+    EXPECT_TRUE(record.match(py_args5, nullptr, record_callback));
+    EXPECT_EQ(options.width, 800);
+    EXPECT_DOUBLE_EQ(options.scale, 1.0);
+    EXPECT_EQ(options.mode, "precise");
+
+    PyObject* py_args6 = createTuple({PyDict_New()});
+    EXPECT_TRUE(record.match(py_args6, nullptr, record_callback));
+    EXPECT_EQ(options.width, 640);
+    EXPECT_EQ(options.mode, "fast");
+
+    // Unknown keys and wrong value types
+    PyObject* py_args7 = createTuple({Py_BuildValue("{s:i,s:i}", "width", 1, "height", 2)});
+    EXPECT_FALSE(record.match(py_args7, nullptr, record_callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    PyObject* py_args8 = createTuple({Py_BuildValue("{s:s}", "scale", "big")});
+    EXPECT_FALSE(record.match(py_args8, nullptr, record_callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args8);
+    Py_DECREF(py_args7);
+    Py_DECREF(py_args6);
+    Py_DECREF(py_args5);
+    Py_DECREF(py_args4);
+    Py_DECREF(py_args3);
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+}
+
+// ============================================================================
+// Test vectorcall argument arrays
+// ============================================================================
+
+TEST_F(PyArgumentsTest, VectorcallArguments)
+{
+    constexpr Arguments args {arg_int {"x"}, arg_optionals {}, arg_int {"y", 7}};
+    constexpr Arguments kw_args {arg_int {"x"}, arg_kw_only {}, arg_int {"y"}};
+    constexpr Arguments var_args {arg_int {"x"}, Arg<VarKw> {}};
+
+    static_assert(decltype(args)::stack_parsable);
+    static_assert(!decltype(kw_args)::stack_parsable);
+    static_assert(!decltype(var_args)::stack_parsable);
+
+    int received_x = 0;
+    int received_y = 0;
+    auto callback = [&](int x, int y) {
+        received_x = x;
+        received_y = y;
+    };
+
+    // No keywords: parsed from the array, no tuple is built before Python 3.13
+    PyObject* stack[] = {PyLong_FromLong(1), PyLong_FromLong(2), PyLong_FromLong(3)};
+    Py_ssize_t refs = Py_REFCNT(stack[0]);
+    EXPECT_TRUE(args.match_vectorcall(stack, 1, nullptr, callback));
+    EXPECT_EQ(received_x, 1);
+    EXPECT_EQ(received_y, 7);
+    EXPECT_TRUE(args.match_vectorcall(stack, 2 | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr, callback));
+    EXPECT_EQ(received_y, 2);
+    EXPECT_EQ(Py_REFCNT(stack[0]), refs);
+
+    // Wrong arity and types are reported like match()
+    EXPECT_FALSE(args.match_vectorcall(stack, 3, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_FALSE(args.match_vectorcall(stack, 0, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    PyObject* bad[] = {PyUnicode_FromString("a")};
+    EXPECT_FALSE(args.match_vectorcall(bad, 1, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    // Keywords go through the tuple and dict path
+    PyObject* kwnames = createTuple({PyUnicode_FromString("y")});
+    EXPECT_TRUE(args.match_vectorcall(stack, 1, kwnames, callback));
+    EXPECT_EQ(received_x, 1);
+    EXPECT_EQ(received_y, 2);
+
+    // Keyword-only arguments are still required without keywords
+    EXPECT_FALSE(kw_args.match_vectorcall(stack, 2, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_TRUE(kw_args.match_vectorcall(stack, 1, kwnames, callback));
+    EXPECT_EQ(received_y, 2);
+
+    Py_DECREF(kwnames);
+    Py_DECREF(bad[0]);
+    for (PyObject* item : stack)
+    {
+        Py_DECREF(item);
+    }
+}
+
+// Test captures viewing the vectorcall array and kwnames in place
+TEST_F(PyArgumentsTest, VectorcallCaptures)
+{
+    constexpr Arguments args {arg_int {"x"},
+                              Arg<VarArgs<PyObject*>> {},
+                              arg_optionals {},
+                              arg_kw_only {},
+                              arg_int {"scale", 1},
+                              Arg<VarKw> {}};
+    constexpr Arguments strict_args {arg_int {"x"}, Arg<VarArgs<PyObject*>> {}};
+
+    int received_x = 0;
+    int received_scale = 0;
+    PyObject* const* rest_data = nullptr;
+    std::size_t rest_size = 0;
+    std::vector<PyObject*> extra_keys;
+    PyObject* extra_a = nullptr;
+    auto callback = [&](int x, VarArgs<PyObject*> rest, int scale, VarKw extra) {
+        received_x = x;
+        received_scale = scale;
+        rest_data = rest.data();
+        rest_size = rest.size();
+        extra_keys.clear();
+        for (const auto& [key, value] : extra)
+        {
+            extra_keys.push_back(key);
+        }
+        extra_a = extra.get("a");
+    };
+
+    // Keyword names are not interned here, so they are matched by value
+    PyObject* kwnames = createTuple({PyUnicode_FromString("a"), PyUnicode_FromString("scale")});
+    PyObject* stack[] = {PyLong_FromLong(1),
+                         PyLong_FromLong(2),
+                         PyLong_FromLong(3),
+                         PyLong_FromLong(4),
+                         PyLong_FromLong(5)};
+
+    EXPECT_TRUE(args.match_vectorcall(stack, 3, kwnames, callback));
+    EXPECT_EQ(received_x, 1);
+    EXPECT_EQ(received_scale, 5);
+    EXPECT_EQ(rest_data, stack + 1); // The array itself, no tuple
+    EXPECT_EQ(rest_size, 2u);
+    ASSERT_EQ(extra_keys.size(), 1u);
+    EXPECT_EQ(extra_keys[0], PyTuple_GET_ITEM(kwnames, 0));
+    EXPECT_EQ(extra_a, stack[3]);
+
+    // No keywords and no extras
+    EXPECT_TRUE(args.match_vectorcall(stack, 1, nullptr, callback));
+    EXPECT_EQ(received_scale, 1);
+    EXPECT_EQ(rest_size, 0u);
+    EXPECT_TRUE(extra_keys.empty());
+
+    // Duplicates and unknown keywords are reported
+    PyObject* dup_names = createTuple({PyUnicode_FromString("x")});
+    EXPECT_FALSE(args.match_vectorcall(stack, 2, dup_names, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    auto strict_callback = [&](int x, VarArgs<PyObject*> rest) {
+        received_x = x + static_cast<int>(rest.size());
+    };
+    EXPECT_FALSE(strict_args.match_vectorcall(stack, 2, kwnames, strict_callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_TRUE(strict_args.match_vectorcall(stack, 3, nullptr, strict_callback));
+    EXPECT_EQ(received_x, 3);
+
+    Py_DECREF(dup_names);
+    Py_DECREF(kwnames);
+    for (PyObject* item : stack)
+    {
+        Py_DECREF(item);
+    }
+}
+
 int main(int argc, char** argv)
 {
     // Initialize Python once for all tests
@@ -316,6 +316,33 @@ TEST_F(PyCxxArgumentsTest, CallableArgument)
     Py_DECREF(py_kwargs);
 }
 
+// ============================================================================
+// Test PyCXX results of typed callables
+// ============================================================================
+
+TEST_F(PyCxxArgumentsTest, PyFunctionWrapperResult)
+{
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* make = PyRun_String("lambda v: v", Py_eval_input, globals, globals);
+    ASSERT_NE(make, nullptr);
+
+    PyFunction<cxx::List(PyObject*)> as_list {make};
+    PyObject* list = createList({PyLong_FromLong(1)});
+    EXPECT_EQ(as_list(list).size(), 1);
+
+    // A result the wrapper rejects is a TypeError, not a PyCXX exception
+    PyObject* number = PyLong_FromLong(1);
+    EXPECT_THROW(as_list(number), PythonError);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(number);
+    Py_DECREF(list);
+    Py_DECREF(make);
+    Py_DECREF(globals);
+}
+
 // ============================================================================
 // Test PyCXX::Bytes argument
 // ============================================================================
@@ -542,6 +569,202 @@ TEST_F(PyCxxArgumentsTest, DispatchOverloadsWithPyCxx)
     Py_DECREF(py_kwargs);
 }
 
+// ============================================================================
+// Test exact-type PyCXX arguments
+// ============================================================================
+
+TEST_F(PyCxxArgumentsTest, ExactTypeArguments)
+{
+    constexpr Arguments args {Arg<Exact<cxx::List>> {"items"}};
+    constexpr Arguments loose {arg_List {"items"}};
+
+    cxx::List received_list;
+    auto callback = [&](cxx::List items) { received_list = items; };
+
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* run = PyRun_String("class L(list): pass\nvalue = L([1, 2])\n",
+                                 Py_file_input,
+                                 globals,
+                                 globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    PyObject* subclass = PyDict_GetItemString(globals, "value");
+
+    PyObject* py_args = createTuple({createList({PyLong_FromLong(7)})});
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(received_list.size(), 1);
+
+    PyObject* py_args2 = createTuple({Py_NewRef(subclass)});
+    EXPECT_FALSE(args.match(py_args2, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    EXPECT_TRUE(loose.match(py_args2, nullptr, callback));
+    EXPECT_EQ(received_list.ptr(), subclass);
+    EXPECT_EQ(received_list.size(), 2);
+
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+    Py_DECREF(globals);
+}
+
+// ============================================================================
+// Test PyCXX type checks
+// ============================================================================
+
+TEST_F(PyCxxArgumentsTest, TypeChecks)
+{
+    PyObject* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject* run = PyRun_String("class D(dict): pass\nvalue = D()\n",
+                                 Py_file_input,
+                                 globals,
+                                 globals);
+    ASSERT_NE(run, nullptr);
+    Py_DECREF(run);
+    PyObject* subclass = PyDict_GetItemString(globals, "value");
+
+    PyObject* tuple = PyTuple_New(0);
+    PyObject* number = PyLong_FromLong(5);
+
+    EXPECT_TRUE(cxx::_Tuple_Check(tuple));
+    EXPECT_FALSE(cxx::_Tuple_Check(number));
+    EXPECT_TRUE(cxx::_Long_Check(number));
+    EXPECT_TRUE(cxx::_Long_Check(Py_True));
+    EXPECT_TRUE(cxx::_Boolean_Check(Py_True));
+    EXPECT_FALSE(cxx::_Boolean_Check(number));
+    EXPECT_TRUE(cxx::_Dict_Check(subclass));
+    EXPECT_FALSE(cxx::_List_Check(subclass));
+    EXPECT_FALSE(PyErr_Occurred());
+
+    Py_DECREF(number);
+    Py_DECREF(tuple);
+    Py_DECREF(globals);
+}
+
+// ============================================================================
+// Test PyCXX move semantics
+// ============================================================================
+
+TEST_F(PyCxxArgumentsTest, MoveSemantics)
+{
+    PyObject* raw = createList({PyLong_FromLong(1), PyLong_FromLong(2)});
+    Py_ssize_t refs = Py_REFCNT(raw);
+
+    cxx::List items(raw, true);
+    EXPECT_EQ(Py_REFCNT(raw), refs);
+
+    // Moves steal the reference
+    cxx::List moved(std::move(items));
+    EXPECT_EQ(items.ptr(), nullptr);
+    EXPECT_EQ(moved.ptr(), raw);
+    EXPECT_EQ(Py_REFCNT(raw), refs);
+
+    cxx::List assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(moved.ptr(), nullptr);
+    EXPECT_EQ(assigned.ptr(), raw);
+    EXPECT_EQ(Py_REFCNT(raw), refs);
+
+    // Copies share it
+    {
+        cxx::List copy(assigned);
+        EXPECT_EQ(Py_REFCNT(raw), refs + 1);
+    }
+    EXPECT_EQ(Py_REFCNT(raw), refs);
+
+    // Conversion between wrappers of a known type
+    cxx::Object object(assigned);
+    auto list = cxx::prechecked_cast<cxx::List>(object);
+    EXPECT_EQ(list.ptr(), raw);
+    EXPECT_EQ(list.size(), 2);
+
+    cxx::Long number(PyLong_FromLong(9), true);
+    cxx::Long other(std::move(number));
+    EXPECT_EQ(static_cast<long>(other), 9);
+}
+
+// ============================================================================
+// Test borrowed PyCXX arguments
+// ============================================================================
+
+TEST_F(PyCxxArgumentsTest, BorrowedArguments)
+{
+    constexpr Arguments args {Arg<cxx::Borrowed<cxx::List>> {"items"},
+                              Arg<cxx::Borrowed<cxx::Object>> {"extra"}};
+
+    PyObject* list = createList({PyLong_FromLong(1), PyLong_FromLong(2)});
+    PyObject* py_args = createTuple({Py_NewRef(list), PyUnicode_FromString("x")});
+    Py_ssize_t refs = Py_REFCNT(list);
+
+    Py_ssize_t size = 0;
+    Py_ssize_t refs_in_callback = 0;
+    cxx::List kept;
+
+    auto callback = [&](cxx::Borrowed<cxx::List> items, cxx::Borrowed<cxx::Object> extra) {
+        size = items->size();
+        refs_in_callback = Py_REFCNT(items.ptr());
+        EXPECT_TRUE(cxx::_Unicode_Check(extra.ptr()));
+        kept = *items;
+    };
+
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(size, 2);
+    EXPECT_EQ(refs_in_callback, refs);
+    EXPECT_EQ(kept.ptr(), list);
+    EXPECT_EQ(Py_REFCNT(list), refs + 1);
+
+    // Still type checked by the parser
+    PyObject* py_args2 = createTuple({PyTuple_New(0), PyUnicode_FromString("x")});
+    EXPECT_FALSE(args.match(py_args2, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+    Py_DECREF(list);
+
+    // Views only hand out const access to the wrapper
+    static_assert(std::is_same_v<decltype(*std::declval<cxx::Borrowed<cxx::List>&>()),
+                                 const cxx::List&>);
+    static_assert(std::is_same_v<decltype(std::declval<cxx::Borrowed<cxx::List>&>().operator->()),
+                                 const cxx::List*>);
+}
+
+TEST_F(PyCxxArgumentsTest, BorrowedCallable)
+{
+    constexpr Arguments args {Arg<cxx::Borrowed<cxx::Callable>> {"func"}};
+
+    PyObject* builtins = PyImport_ImportModule("builtins");
+    ASSERT_NE(builtins, nullptr);
+    PyObject* func = PyObject_GetAttrString(builtins, "len");
+    Py_DECREF(builtins);
+    ASSERT_NE(func, nullptr);
+    PyObject* py_args = createTuple({Py_NewRef(func)});
+    Py_ssize_t refs = Py_REFCNT(func);
+
+    long result = 0;
+    auto callback = [&](cxx::Borrowed<cxx::Callable> f) {
+        EXPECT_EQ(Py_REFCNT(f.ptr()), refs);
+        cxx::Tuple call_args(1);
+        call_args[0] = cxx::String("abc");
+        result = cxx::Long(f->apply(call_args)).as_long();
+    };
+
+    EXPECT_TRUE(args.match(py_args, nullptr, callback));
+    EXPECT_EQ(result, 3);
+
+    PyObject* py_args2 = createTuple({PyLong_FromLong(1)});
+    EXPECT_FALSE(args.match(py_args2, nullptr, callback));
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+
+    Py_DECREF(py_args2);
+    Py_DECREF(py_args);
+    Py_DECREF(func);
+}
+
 int main(int argc, char** argv)
 {
     // Initialize Python once for all tests
@@ -0,0 +1,827 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright 2025 Frank David Martínez M. <mnesarco>
+// Test file for PyCXX extension modules and types
+// NOLINTBEGIN(modernize-use-trailing-return-type)
+
+#include "../PyArguments.hxx"
+#include "CXX/Extensions.hxx"
+#include <Python.h>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace cxx = ::Py;
+using namespace Base::PyArgs;
+
+// ============================================================================
+// Test module
+// ============================================================================
+
+class TestModule : public cxx::ExtensionModule<TestModule>
+{
+public:
+    TestModule()
+        : cxx::ExtensionModule<TestModule>("pycxx_test")
+    {
+        add_varargs_method("count", &TestModule::count, "Number of arguments");
+        add_fastcall_method<&TestModule::fast_sum>("fast_sum", "Sum of the arguments");
+        add_fastcall_method<&TestModule::fast_fail>("fast_fail");
+        initialize("PyCXX extension test module");
+    }
+
+    cxx::Object count(const cxx::Tuple& args)
+    {
+        return cxx::Long(static_cast<long>(args.size()));
+    }
+
+    // Positionals are summed, keyword "scale" multiplies the result
+    cxx::Object fast_sum(PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
+    {
+        long total = 0;
+        for (Py_ssize_t i = 0; i < nargs; i++)
+        {
+            total += PyLong_AsLong(args[i]);
+        }
+        Py_ssize_t nkw = kwnames ? PyTuple_GET_SIZE(kwnames) : 0;
+        for (Py_ssize_t i = 0; i < nkw; i++)
+        {
+            if (PyUnicode_CompareWithASCIIString(PyTuple_GET_ITEM(kwnames, i), "scale") == 0)
+            {
+                total *= PyLong_AsLong(args[nargs + i]);
+            }
+        }
+        return cxx::Long(total);
+    }
+
+    cxx::Object fast_fail(PyObject* const*, Py_ssize_t, PyObject*)
+    {
+        throw cxx::ValueError("fast_fail");
+    }
+};
+
+// ============================================================================
+// Test static module
+// ============================================================================
+
+cxx::Object static_answer()
+{
+    return cxx::Long(42L);
+}
+
+cxx::Object static_count(const cxx::Tuple& args)
+{
+    return cxx::Long(static_cast<long>(args.size()));
+}
+
+cxx::Object static_keywords(const cxx::Tuple& args, const cxx::Dict& kws)
+{
+    return cxx::Long(static_cast<long>(args.size() + kws.size()));
+}
+
+cxx::Object static_last(PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
+{
+    Py_ssize_t total = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0);
+    if (total == 0)
+    {
+        throw cxx::ValueError("no arguments");
+    }
+    return cxx::Object(args[total - 1]);
+}
+
+PyMethodDef static_methods[] = {cxx::method_def<&static_answer>("answer", "The answer"),
+                                cxx::method_def<&static_count>("count"),
+                                cxx::method_def<&static_keywords>("keywords"),
+                                cxx::method_def<&static_last>("last"),
+                                cxx::method_def_end()};
+
+cxx::StaticModuleDef static_module_def("pycxx_static", "Static test module", static_methods);
+
+// ============================================================================
+// Test extension type
+// ============================================================================
+
+class Counter : public cxx::PythonExtension<Counter>
+{
+public:
+    long value = 0;
+
+    static void init_type()
+    {
+        behaviors().name("Counter");
+        behaviors().doc("Counter test type");
+        behaviors().supportGetattro();
+        add_noargs_method("get", &Counter::get, "Current value");
+        add_varargs_method("add", &Counter::add);
+        add_keyword_method("reset", &Counter::reset);
+        behaviors().set_slot(Py_sq_length, length_slot<&Counter::length>);
+    }
+
+    // Methods resolved from the str attribute name
+    cxx::Object getattro(const cxx::String& name) override
+    {
+        return getattro_methods(name);
+    }
+
+    long length() const
+    {
+        return value;
+    }
+
+    cxx::Object get()
+    {
+        return cxx::Long(value);
+    }
+
+    cxx::Object add(const cxx::Tuple& args)
+    {
+        for (const auto& item : args)
+        {
+            value += static_cast<long>(cxx::Long(item));
+        }
+        return cxx::Long(value);
+    }
+
+    cxx::Object reset(const cxx::Tuple& args, const cxx::Dict& kws)
+    {
+        value = args.size() > 0 ? static_cast<long>(cxx::Long(args[0])) : 0;
+        if (kws.hasKey("offset"))
+        {
+            value += static_cast<long>(cxx::Long(kws["offset"]));
+        }
+        return cxx::Long(value);
+    }
+};
+
+// ============================================================================
+// Test class with a vectorcall constructor
+// ============================================================================
+
+class Vec : public cxx::PythonClass<Vec>
+{
+public:
+    static constexpr Arguments signature {
+        arg_double {"x"}, arg_double {"y"}, arg_optionals {}, arg_double {"z", 0.0}};
+
+    double x = 0;
+    double y = 0;
+    double z = 0;
+    std::string label;
+
+    // Python subclasses, which do not inherit the vectorcall constructor
+    Vec(cxx::PythonClassInstance* self, cxx::Tuple& args, cxx::Dict& kws)
+        : cxx::PythonClass<Vec>(self, args, kws)
+    {
+        bool ok = signature.match(args.ptr(), kws.ptr(), [this](double x, double y, double z) {
+            this->x = x;
+            this->y = y;
+            this->z = z;
+        });
+        if (!ok)
+        {
+            throw cxx::Exception();
+        }
+    }
+
+    Vec(cxx::PythonClassInstance* self, double x, double y, double z)
+        : cxx::PythonClass<Vec>(self)
+        , x(x)
+        , y(y)
+        , z(z)
+    {
+        if (std::isnan(x))
+        {
+            throw cxx::ValueError("x is nan");
+        }
+    }
+
+    static void init_type()
+    {
+        behaviors().name("Vec");
+        behaviors().doc("Vector test class");
+        PYCXX_ADD_NOARGS_METHOD(sum, sum, "x + y + z");
+        set_vectorcall_init<&vectorcall_init<Vec, signature>>();
+        behaviors().set_slot(Py_nb_add, binary_slot<&Vec::operator+>);
+        behaviors().set_slot(Py_nb_multiply, binary_slot<&Vec::scale, &Vec::scale>);
+        behaviors().set_slot(Py_nb_negative, unary_slot<&Vec::negative>);
+        behaviors().set_slot(Py_sq_length, length_slot<&Vec::size>);
+        behaviors().set_slot(Py_sq_item, item_slot<&Vec::item>);
+        behaviors().set_slot(Py_sq_ass_item, ass_item_slot<&Vec::set_item>);
+        behaviors().set_slot(Py_sq_contains, contains_slot<&Vec::contains>);
+        behaviors().set_slot(Py_tp_richcompare, richcompare_slot<&Vec::compare>);
+        static PyGetSetDef getset[] = {getset_def<&Vec::x>("x", "X coordinate"),
+                                       getset_def<&Vec::y>("y"),
+                                       getset_def<&Vec::z, nullptr>("z"),
+                                       getset_def<&Vec::norm2>("norm2"),
+                                       getset_def<&Vec::get_label, &Vec::set_label>("label"),
+                                       getset_def_end()};
+        behaviors().set_slot(Py_tp_getset, getset);
+        behaviors().set_slot(Py_tp_getattro, PyObject_GenericGetAttr);
+        behaviors().set_slot(Py_tp_setattro, PyObject_GenericSetAttr);
+        behaviors().readyType();
+    }
+
+    cxx::Object sum()
+    {
+        return cxx::Long(static_cast<long>(x + y + z));
+    }
+    PYCXX_NOARGS_METHOD_DECL(Vec, sum)
+
+    Vec operator+(const Vec& other) const
+    {
+        return Vec(nullptr, x + other.x, y + other.y, z + other.z);
+    }
+
+    Vec scale(double factor) const
+    {
+        return Vec(nullptr, x * factor, y * factor, z * factor);
+    }
+
+    Vec negative() const
+    {
+        return Vec(nullptr, -x, -y, -z);
+    }
+
+    Py_ssize_t size() const
+    {
+        return 3;
+    }
+
+    double item(Py_ssize_t index) const
+    {
+        if (index < 0 || index >= 3)
+        {
+            throw cxx::IndexError("Vec index out of range");
+        }
+        return index == 0 ? x : index == 1 ? y : z;
+    }
+
+    void set_item(Py_ssize_t index, double value)
+    {
+        if (index < 0 || index >= 3)
+        {
+            throw cxx::IndexError("Vec index out of range");
+        }
+        (index == 0 ? x : index == 1 ? y : z) = value;
+    }
+
+    bool contains(double value) const
+    {
+        return x == value || y == value || z == value;
+    }
+
+    double norm2() const
+    {
+        return x * x + y * y + z * z;
+    }
+
+    std::string_view get_label() const
+    {
+        return label;
+    }
+
+    void set_label(std::string_view value)
+    {
+        if (value.empty())
+        {
+            throw cxx::ValueError("empty label");
+        }
+        label = value;
+    }
+
+    bool compare(const Vec& other, int op) const
+    {
+        bool equal = x == other.x && y == other.y && z == other.z;
+        if (op != Py_EQ && op != Py_NE)
+        {
+            throw cxx::TypeError("Vec only supports == and !=");
+        }
+        return op == Py_EQ ? equal : !equal;
+    }
+};
+
+// ============================================================================
+// Test buffer export
+// ============================================================================
+
+struct Point
+{
+    double x;
+    double y;
+    double z;
+};
+
+// Points exports n x 3 coordinates, Column the read-only y column
+template <bool Column>
+class PointsT : public cxx::PythonClass<PointsT<Column>>
+{
+public:
+    std::vector<Point> points;
+
+    PointsT(cxx::PythonClassInstance* self, cxx::Tuple& args, cxx::Dict& kws)
+        : cxx::PythonClass<PointsT>(self, args, kws)
+    {
+        long count = args.size() > 0 ? static_cast<long>(cxx::Long(args[0])) : 0;
+        for (long i = 0; i < count; i++)
+        {
+            auto value = static_cast<double>(i);
+            points.push_back({value, value * 10, value * 100});
+        }
+    }
+
+    static void init_type()
+    {
+        using base = cxx::PythonClass<PointsT>;
+        base::behaviors().name(Column ? "PointColumn" : "Points");
+        base::behaviors().set_slot(Py_bf_getbuffer, buffer_slot<&PointsT::buffer>);
+        base::behaviors().set_slot(Py_bf_releasebuffer, release_buffer);
+        base::behaviors().readyType();
+    }
+
+    auto buffer() const
+    {
+        auto count = static_cast<Py_ssize_t>(points.size());
+        if constexpr (Column)
+        {
+            return Buffer<const double> {&points.data()->y, {count}, {sizeof(Point)}};
+        }
+        else
+        {
+            return Buffer<double, 2> {const_cast<double*>(&points.data()->x), {count, 3}};
+        }
+    }
+};
+
+using Points = PointsT<false>;
+using PointColumn = PointsT<true>;
+
+// Samples exports a vector as a 1-D buffer
+class Samples : public cxx::PythonClass<Samples>
+{
+public:
+    std::vector<std::int16_t> values {1, 2, 3, 4};
+
+    Samples(cxx::PythonClassInstance* self, cxx::Tuple& args, cxx::Dict& kws)
+        : cxx::PythonClass<Samples>(self, args, kws)
+    {}
+
+    static void init_type()
+    {
+        behaviors().name("Samples");
+        behaviors().set_slot(Py_bf_getbuffer, buffer_slot<&Samples::data>);
+        behaviors().set_slot(Py_bf_releasebuffer, release_buffer);
+        behaviors().readyType();
+    }
+
+    std::vector<std::int16_t>& data()
+    {
+        return values;
+    }
+};
+
+class PyCxxExtensionsTest : public ::testing::Test
+{
+protected:
+    static PyObject* module()
+    {
+        static auto* instance = new TestModule();
+        return instance->module().ptr();
+    }
+
+    static PyObject* static_module()
+    {
+        static PyObject* instance = static_module_def.create();
+        return instance;
+    }
+
+    static PyObject* counter()
+    {
+        static bool initialized = false;
+        if (!initialized)
+        {
+            Counter::init_type();
+            initialized = true;
+        }
+        return new Counter();
+    }
+
+    static PyObject* vec_type()
+    {
+        static bool initialized = false;
+        if (!initialized)
+        {
+            Vec::init_type();
+            initialized = true;
+        }
+        return reinterpret_cast<PyObject*>(Vec::type_object());
+    }
+
+    static void buffer_types(PyObject* globals)
+    {
+        static bool initialized = false;
+        if (!initialized)
+        {
+            Points::init_type();
+            PointColumn::init_type();
+            Samples::init_type();
+            initialized = true;
+        }
+        PyDict_SetItemString(globals, "Points", reinterpret_cast<PyObject*>(Points::type_object()));
+        PyDict_SetItemString(globals,
+                             "PointColumn",
+                             reinterpret_cast<PyObject*>(PointColumn::type_object()));
+        PyDict_SetItemString(globals,
+                             "Samples",
+                             reinterpret_cast<PyObject*>(Samples::type_object()));
+    }
+
+    // Run Python code with the test module bound to "m", returns the global "value"
+    static long eval(const char* code)
+    {
+        PyObject* globals = PyDict_New();
+        PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+        PyDict_SetItemString(globals, "m", module());
+        PyDict_SetItemString(globals, "s", static_module());
+        PyObject* instance = counter();
+        PyDict_SetItemString(globals, "c", instance);
+        Py_DECREF(instance);
+        PyDict_SetItemString(globals, "Vec", vec_type());
+        buffer_types(globals);
+        PyObject* result = PyRun_String(code, Py_file_input, globals, globals);
+        long value = -1;
+        if (result)
+        {
+            value = PyLong_AsLong(PyDict_GetItemString(globals, "value"));
+            Py_DECREF(result);
+        }
+        Py_DECREF(globals);
+        return value;
+    }
+};
+
+// ============================================================================
+// Test module methods
+// ============================================================================
+
+TEST_F(PyCxxExtensionsTest, VarargsMethod)
+{
+    EXPECT_EQ(eval("value = m.count(1, 2, 3)"), 3);
+}
+
+TEST_F(PyCxxExtensionsTest, FastcallMethod)
+{
+    EXPECT_EQ(eval("value = m.fast_sum(1, 2, 3)"), 6);
+    EXPECT_EQ(eval("value = m.fast_sum(1, 2, scale=10)"), 30);
+    EXPECT_EQ(eval("value = m.fast_sum()"), 0);
+    EXPECT_EQ(eval("value = m.fast_sum.__doc__ == 'Sum of the arguments'"), 1);
+}
+
+TEST_F(PyCxxExtensionsTest, FastcallMethodError)
+{
+    EXPECT_EQ(eval("value = m.fast_fail()"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+}
+
+TEST_F(PyCxxExtensionsTest, StaticModule)
+{
+    EXPECT_EQ(eval("value = s.answer()"), 42);
+    EXPECT_EQ(eval("value = s.answer.__doc__ == 'The answer'"), 1);
+    EXPECT_EQ(eval("value = s.count(1, 2)"), 2);
+    EXPECT_EQ(eval("value = s.keywords(1, a=2, b=3)"), 3);
+    EXPECT_EQ(eval("value = s.keywords()"), 0);
+    EXPECT_EQ(eval("value = s.last(1, 2, x=7)"), 7);
+    EXPECT_EQ(eval("value = s.__name__ == 'pycxx_static'"), 1);
+
+    EXPECT_EQ(eval("value = s.last()"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+}
+
+// ============================================================================
+// Test extension type methods
+// ============================================================================
+
+TEST_F(PyCxxExtensionsTest, TypeMethods)
+{
+    EXPECT_EQ(eval("value = c.add(2, 3)"), 5);
+    EXPECT_EQ(eval("c.add(4)\nvalue = c.get()"), 4);
+    EXPECT_EQ(eval("value = c.reset(7, offset=3)"), 10);
+    EXPECT_EQ(eval("value = c.reset()"), 0);
+}
+
+TEST_F(PyCxxExtensionsTest, TypeBoundMethods)
+{
+    // Bound to the instance, sharing one function per method
+    EXPECT_EQ(eval("value = c.get.__self__ is c"), 1);
+    EXPECT_EQ(eval("value = c.get.__func__ is c.get.__func__"), 1);
+    EXPECT_EQ(eval("value = c.get.__doc__ == 'Current value'"), 1);
+    EXPECT_EQ(eval("f = c.add\nf(5)\nvalue = f(1)"), 6);
+
+    // Argument errors
+    EXPECT_EQ(eval("value = c.get(1)"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("value = c.add(x=1)"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("value = c.get.__func__(1)"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+}
+
+// ============================================================================
+// Test vectorcall constructors
+// ============================================================================
+
+TEST_F(PyCxxExtensionsTest, VectorcallConstructor)
+{
+    EXPECT_TRUE(reinterpret_cast<PyTypeObject*>(vec_type())->tp_vectorcall != nullptr);
+    EXPECT_EQ(eval("value = Vec(1, 2, 3).sum()"), 6);
+    EXPECT_EQ(eval("value = Vec(1, 2).sum()"), 3);
+    EXPECT_EQ(eval("value = Vec(1, y=2, z=4).sum()"), 7);
+    EXPECT_EQ(eval("value = Vec(z=1, y=2, x=3).sum()"), 6);
+    EXPECT_EQ(eval("value = type(Vec(1, 2)) is Vec"), 1);
+
+    // Python subclasses go through tp_new + tp_init
+    EXPECT_EQ(eval("class Sub(Vec): pass\nvalue = Sub(1, 2, z=5).sum()"), 8);
+
+    // Parse errors and exceptions from the constructor
+    EXPECT_EQ(eval("value = Vec(1)"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("value = Vec('a', 2)"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("value = Vec(float('nan'), 2)"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+}
+
+// ============================================================================
+// Test typed slots
+// ============================================================================
+
+TEST_F(PyCxxExtensionsTest, TypedNumberSlots)
+{
+    EXPECT_EQ(eval("value = (Vec(1, 2, 3) + Vec(1, 1, 1)).sum()"), 9);
+    EXPECT_EQ(eval("value = (Vec(1, 2, 3) * 2).sum()"), 12);
+    EXPECT_EQ(eval("value = (3 * Vec(1, 2, 3)).sum()"), 18);
+    EXPECT_EQ(eval("value = (-Vec(1, 2, 3)).sum()"), -6);
+    EXPECT_EQ(eval("class Sub(Vec): pass\nvalue = (Sub(1, 2) + Vec(1, 1)).sum()"), 5);
+    EXPECT_EQ(eval("value = type(Vec(1, 2) + Vec(1, 1)) is Vec"), 1);
+    EXPECT_EQ(eval("v = Vec(1, 2) * 2\nv.x = 5\nvalue = v.sum()"), 9);
+
+    // Functions of another slot signature are rejected
+    cxx::PythonType scratch(sizeof(cxx::PythonClassInstance), 0, "Scratch");
+    EXPECT_THROW(scratch.set_slot(Py_nb_bool, unary_slot<&Vec::negative>), cxx::TypeError);
+    PyErr_Clear();
+    EXPECT_NO_THROW(scratch.set_slot(Py_nb_negative, unary_slot<&Vec::negative>));
+
+    // Operands that do not convert give NotImplemented, then TypeError
+    EXPECT_EQ(eval("value = Vec(1, 2) + 1"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("value = Vec(1, 2) * 'a'"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+}
+
+TEST_F(PyCxxExtensionsTest, TypedSequenceSlots)
+{
+    EXPECT_EQ(eval("value = len(Vec(1, 2))"), 3);
+    EXPECT_EQ(eval("c.add(4)\nvalue = len(c)"), 4);
+    EXPECT_EQ(eval("value = int(Vec(1, 2, 3)[1])"), 2);
+    EXPECT_EQ(eval("value = int(Vec(1, 2, 3)[-1])"), 3);
+    EXPECT_EQ(eval("value = int(sum(list(Vec(1, 2, 3))))"), 6);
+    EXPECT_EQ(eval("v = Vec(1, 2, 3)\nv[0] = 5\nvalue = v.sum()"), 10);
+    EXPECT_EQ(eval("value = 2 in Vec(1, 2, 3)"), 1);
+    EXPECT_EQ(eval("value = 'a' in Vec(1, 2, 3)"), 0);
+
+    EXPECT_EQ(eval("value = Vec(1, 2, 3)[3]"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_IndexError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("v = Vec(1, 2, 3)\nv[0] = 'a'"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("v = Vec(1, 2, 3)\ndel v[0]"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+}
+
+TEST_F(PyCxxExtensionsTest, TypedRichCompareSlot)
+{
+    EXPECT_EQ(eval("value = Vec(1, 2, 3) == Vec(1, 2, 3)"), 1);
+    EXPECT_EQ(eval("value = Vec(1, 2, 3) != Vec(1, 2, 4)"), 1);
+    EXPECT_EQ(eval("value = Vec(1, 2, 3) == 1"), 0);
+
+    EXPECT_EQ(eval("value = Vec(1, 2) < Vec(2, 3)"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+}
+
+TEST_F(PyCxxExtensionsTest, InstanceFreelist)
+{
+    vec_type();
+    Vec::set_freelist_size(2);
+    EXPECT_EQ(eval("items = [Vec(i, 1) for i in range(5)]\ndel items\nvalue = 0"), 0);
+    EXPECT_EQ(Vec::freelist_size(), 2);
+
+    // New instances take their memory from the list, the last freed first
+    PyObject* reused = PyObject_CallFunction(vec_type(), "dd", 2.0, 3.0);
+    ASSERT_NE(reused, nullptr);
+    EXPECT_EQ(Vec::freelist_size(), 1);
+    Py_DECREF(reused);
+    EXPECT_EQ(Vec::freelist_size(), 2);
+    EXPECT_EQ(eval("a = Vec(1, 2)\naddress = id(a)\ndel a\nvalue = id(Vec(3, 4)) == address"), 1);
+
+    // Reused objects start from a clean instance
+    EXPECT_EQ(eval("a = Vec(2, 3)\nvalue = a.sum()"), 5);
+    EXPECT_EQ(Vec::freelist_size(), 2);
+    EXPECT_EQ(eval("a = Vec(4, 3)\nb = Vec(1, 1)\nc = Vec(1, 2)\n"
+                   "value = a.sum() + b.sum() + c.sum()"),
+              12);
+
+    // Subclass instances are never pooled
+    EXPECT_EQ(eval("class Sub(Vec): pass\n"
+                   "items = [Sub(1, 2) for i in range(3)]\nvalue = len(items)"),
+              3);
+
+    Vec::set_freelist_size(1);
+    EXPECT_EQ(Vec::freelist_size(), 1);
+    Vec::set_freelist_size(0);
+    EXPECT_EQ(Vec::freelist_size(), 0);
+    EXPECT_EQ(eval("a = Vec(1, 2)\nvalue = a.sum()"), 3);
+    EXPECT_EQ(Vec::freelist_size(), 0);
+}
+
+// ============================================================================
+// Test typed properties
+// ============================================================================
+
+TEST_F(PyCxxExtensionsTest, TypedProperties)
+{
+    EXPECT_EQ(eval("v = Vec(1, 2, 3)\nvalue = int(v.x + v.y + v.z)"), 6);
+    EXPECT_EQ(eval("v = Vec(1, 2, 3)\nv.x = 4\nvalue = v.sum()"), 9);
+    EXPECT_EQ(eval("value = int(Vec(1, 2, 3).norm2)"), 14);
+    EXPECT_EQ(eval("v = Vec(1, 2)\nv.label = 'a'\nvalue = v.label == 'a'"), 1);
+    EXPECT_EQ(eval("value = Vec.x.__doc__ == 'X coordinate'"), 1);
+    EXPECT_EQ(eval("value = type(Vec.__dict__['x']).__name__ == 'getset_descriptor'"), 1);
+    EXPECT_EQ(eval("class Sub(Vec): pass\n"
+                   "s = Sub(1, 2)\ns.y = 5\ns.w = 1\nvalue = int(s.y) + s.w"),
+              6);
+
+    // Conversion errors, read-only attributes and deletion
+    EXPECT_EQ(eval("v = Vec(1, 2)\nv.x = 'a'"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("v = Vec(1, 2)\nv.z = 1"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_AttributeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("v = Vec(1, 2)\nv.norm2 = 1"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_AttributeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("v = Vec(1, 2)\ndel v.x"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("v = Vec(1, 2)\nv.label = ''"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_ValueError));
+    PyErr_Clear();
+}
+
+// ============================================================================
+// Test buffer export
+// ============================================================================
+
+TEST_F(PyCxxExtensionsTest, BufferExport)
+{
+    // 2-D, writable, C-contiguous
+    EXPECT_EQ(eval("m = memoryview(Points(4))\nvalue = m.shape == (4, 3) and m.format == 'd'"), 1);
+    EXPECT_EQ(eval("m = memoryview(Points(4))\n"
+                   "value = m.strides == (24, 8) and not m.readonly"),
+              1);
+    EXPECT_EQ(eval("value = int(memoryview(Points(4))[2, 1])"), 20);
+    EXPECT_EQ(eval("p = Points(2)\nm = memoryview(p)\nm[1, 2] = 7\n"
+                   "value = int(memoryview(p)[1, 2])"),
+              7);
+    EXPECT_EQ(eval("value = len(bytes(Points(2)))"), 48);
+    EXPECT_EQ(eval("m = memoryview(Points(3))\ndel Points\nvalue = int(m[2, 0])"), 2);
+
+    // 1-D from a vector
+    EXPECT_EQ(eval("m = memoryview(Samples())\n"
+                   "value = m.format == 'h' and m.tolist() == [1, 2, 3, 4]"),
+              1);
+
+    // Strided, read-only column
+    EXPECT_EQ(eval("m = memoryview(PointColumn(3))\nvalue = m.readonly and m.strides == (24,)"), 1);
+    EXPECT_EQ(eval("value = memoryview(PointColumn(3)).tolist() == [0, 10, 20]"), 1);
+    EXPECT_EQ(eval("m = memoryview(PointColumn(3))\nm[0] = 1.0"), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_TypeError));
+    PyErr_Clear();
+    EXPECT_EQ(eval("value = bytes(PointColumn(2)) == bytes(memoryview(PointColumn(2)))"), 1);
+
+    // Contiguous requests of the strided column
+    auto* column_type = reinterpret_cast<PyObject*>(PointColumn::type_object());
+    PyObject* column = PyObject_CallFunction(column_type, "i", 3);
+    ASSERT_TRUE(column != nullptr);
+    Py_buffer view {};
+    EXPECT_EQ(PyObject_GetBuffer(column, &view, PyBUF_SIMPLE), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_BufferError));
+    PyErr_Clear();
+    EXPECT_EQ(PyObject_GetBuffer(column, &view, PyBUF_C_CONTIGUOUS), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_BufferError));
+    PyErr_Clear();
+    EXPECT_EQ(PyObject_GetBuffer(column, &view, PyBUF_F_CONTIGUOUS), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_BufferError));
+    PyErr_Clear();
+    EXPECT_EQ(PyObject_GetBuffer(column, &view, PyBUF_ANY_CONTIGUOUS), -1);
+    EXPECT_TRUE(PyErr_ExceptionMatches(PyExc_BufferError));
+    PyErr_Clear();
+    ASSERT_EQ(PyObject_GetBuffer(column, &view, PyBUF_STRIDES), 0);
+    EXPECT_EQ(view.len, 3 * static_cast<Py_ssize_t>(sizeof(double)));
+    EXPECT_EQ(view.shape[0], 3);
+    EXPECT_TRUE(view.format == nullptr);
+    PyBuffer_Release(&view);
+    Py_DECREF(column);
+}
+
+// ============================================================================
+// Test method lookup table
+// ============================================================================
+
+TEST_F(PyCxxExtensionsTest, MethodMapLookup)
+{
+    cxx::MethodMap<int> map;
+    for (int i = 0; i < 150; i++)
+    {
+        map["method_" + std::to_string(i)] = i;
+    }
+    EXPECT_EQ(map.size(), 150U);
+    EXPECT_EQ(map.begin()->first, "method_0");
+    EXPECT_EQ((map.begin() + 1)->first, "method_1");
+
+    // By C string
+    EXPECT_EQ(map.find("method_42")->second, 42);
+    EXPECT_EQ(map.find("method_149")->second, 149);
+    EXPECT_TRUE(map.find("method_150") == map.end());
+
+    // By interned and by non-interned str
+    PyObject* interned = PyUnicode_InternFromString("method_7");
+    PyObject* plain = PyUnicode_FromFormat("method_%d", 99);
+    PyObject* missing = PyUnicode_FromString("missing");
+    EXPECT_EQ(map.find_object(interned)->second, 7);
+    EXPECT_EQ(map.find_object(plain)->second, 99);
+    EXPECT_TRUE(map.find_object(missing) == map.end());
+    EXPECT_TRUE(map.find_object(Py_None) == map.end());
+    EXPECT_TRUE(map.find(NULL) == map.end());
+    EXPECT_TRUE(map.find_object(nullptr) == map.end());
+
+    // Inserting invalidates the indexes
+    map["method_150"] = 150;
+    EXPECT_EQ(map.find("method_150")->second, 150);
+    EXPECT_EQ(map.find_object(interned)->second, 7);
+    EXPECT_FALSE(PyErr_Occurred());
+
+    // Copies and moves own their interned names and indexes
+    Py_ssize_t refs = Py_REFCNT(interned);
+    {
+        cxx::MethodMap<int> copy(map);
+        EXPECT_EQ(copy.size(), 151U);
+        EXPECT_EQ(copy.find_object(interned)->second, 7);
+        EXPECT_EQ(Py_REFCNT(interned), refs + 1);
+
+        cxx::MethodMap<int> moved(std::move(copy));
+        EXPECT_EQ(moved.find_object(interned)->second, 7);
+        EXPECT_EQ(Py_REFCNT(interned), refs + 1);
+
+        cxx::MethodMap<int> assigned;
+        assigned["other"] = 1;
+        assigned = moved;
+        EXPECT_EQ(assigned.find("method_3")->second, 3);
+        EXPECT_TRUE(assigned.find("other") == assigned.end());
+        EXPECT_EQ(assigned.find_object(interned)->second, 7);
+        EXPECT_EQ(Py_REFCNT(interned), refs + 2);
+    }
+    EXPECT_EQ(Py_REFCNT(interned), refs);
+
+    Py_DECREF(missing);
+    Py_DECREF(plain);
+    Py_DECREF(interned);
+}
+
+int main(int argc, char** argv)
+{
+    // Initialize Python once for all tests
+    Py_Initialize();
+
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+
+    // Cleanup Python
+    Py_Finalize();
+
+    return result;
+}
+
+// NOLINTEND(modernize-use-trailing-return-type)